@@ -34,38 +34,117 @@ SerializationContext::ObjectData const* SerializationContext::GetObjectById(cons
 
 void* SerializationContext::CreateTempVariable(const rttr::Type& type)
 {
-	void* temp = type.Instantiate();
+	TempVariable tempVar{ nullptr, type, m_arenaBlockIdx, m_arenaOffset, false };
 
-	auto varAddressAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(temp));
-	Log::LogMessage("Temp variable created: (%s; 0x%llX)", type.GetName(), varAddressAsInt);
+	if (type.CanConstructInPlace() && type.GetAlignment() <= alignof(std::max_align_t))
+	{
+		tempVar.ptr = AllocateFromArena(type.GetSize(), type.GetAlignment());
+		type.ConstructInPlace(tempVar.ptr);
+		tempVar.inArena = true;
+	}
+	else
+	{
+		// Types with custom allocators or over-aligned types still go to the heap
+		tempVar.ptr = type.Instantiate();
+	}
+
+	auto varAddressAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(tempVar.ptr));
+	RS_LOG_TRACE("Temp variable created: (%s; 0x%llX)", type.GetName(), varAddressAsInt);
 
-	m_tempVariables.emplace(temp, type);
-	return temp;
+	m_tempVariables.push_back(tempVar);
+	return tempVar.ptr;
 }
 
 void SerializationContext::DestroyTempVariable(void* ptr)
 {
-	auto it = m_tempVariables.find(ptr);
-	if (it != m_tempVariables.end())
+	// Variables are usually destroyed in reverse creation order, so search from the end
+	for (auto it = m_tempVariables.rbegin(); it != m_tempVariables.rend(); ++it)
 	{
-		auto varAddressAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(ptr));
-		Log::LogMessage("Temp variable destroyed: (%s; 0x%llX)", it->second.GetName(), varAddressAsInt);
+		if (it->ptr == ptr)
+		{
+			ReleaseTempVariable(*it);
+			it->ptr = nullptr;
 
-		it->second.Destroy(ptr);
-		m_tempVariables.erase(it);
+			PopReleasedTempVariables();
+			return;
+		}
 	}
 }
 
 void SerializationContext::ClearTempVariables()
 {
-	for (const auto& tempVar : m_tempVariables)
+	for (auto it = m_tempVariables.rbegin(); it != m_tempVariables.rend(); ++it)
 	{
-		auto varAddressAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(tempVar.first));
-		Log::LogMessage("Temp variable destroyed: (%s; 0x%llX)", tempVar.second.GetName(), varAddressAsInt);
-
-		tempVar.second.Destroy(tempVar.first);
+		if (nullptr != it->ptr)
+		{
+			ReleaseTempVariable(*it);
+		}
 	}
+
 	m_tempVariables.clear();
+
+	// Arena blocks are kept for reuse
+	m_arenaBlockIdx = 0U;
+	m_arenaOffset = 0U;
+}
+
+void* SerializationContext::AllocateFromArena(const std::size_t size, const std::size_t alignment)
+{
+	constexpr std::size_t k_initialBlockSize = 4096U;
+
+	while (m_arenaBlockIdx < m_arenaBlocks.size())
+	{
+		const ArenaBlock& block = m_arenaBlocks[m_arenaBlockIdx];
+		const std::size_t offset = (m_arenaOffset + alignment - 1U) & ~(alignment - 1U);
+
+		if (offset + size <= block.size)
+		{
+			m_arenaOffset = offset + size;
+			return reinterpret_cast<std::byte*>(block.memory.get()) + offset;
+		}
+
+		++m_arenaBlockIdx;
+		m_arenaOffset = 0U;
+	}
+
+	// Each new block is twice as big as previous one, and always fits requested size
+	std::size_t blockSize = m_arenaBlocks.empty() ? k_initialBlockSize : m_arenaBlocks.back().size * 2U;
+	if (blockSize < size)
+	{
+		blockSize = size;
+	}
+
+	const std::size_t itemsCount = (blockSize + sizeof(std::max_align_t) - 1U) / sizeof(std::max_align_t);
+	m_arenaBlocks.push_back(ArenaBlock{ std::unique_ptr<std::max_align_t[]>(new std::max_align_t[itemsCount]), itemsCount * sizeof(std::max_align_t) });
+
+	m_arenaBlockIdx = m_arenaBlocks.size() - 1U;
+	m_arenaOffset = size;
+	return m_arenaBlocks.back().memory.get();
+}
+
+void SerializationContext::ReleaseTempVariable(const TempVariable& tempVar)
+{
+	auto varAddressAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(tempVar.ptr));
+	RS_LOG_TRACE("Temp variable destroyed: (%s; 0x%llX)", tempVar.type.GetName(), varAddressAsInt);
+
+	if (tempVar.inArena)
+	{
+		tempVar.type.DestroyInPlace(tempVar.ptr);
+	}
+	else
+	{
+		tempVar.type.Destroy(tempVar.ptr);
+	}
+}
+
+void SerializationContext::PopReleasedTempVariables()
+{
+	while (!m_tempVariables.empty() && nullptr == m_tempVariables.back().ptr)
+	{
+		m_arenaBlockIdx = m_tempVariables.back().arenaBlockIdx;
+		m_arenaOffset = m_tempVariables.back().arenaOffset;
+		m_tempVariables.pop_back();
+	}
 }
 
 } // namespace detail
@@ -3,12 +3,36 @@
 #include "rttr/Property.hpp"
 
 #include <unordered_map>
+#include <vector>
+#include <memory>
+#include <cstddef>
 
 namespace rs
 {
 namespace detail
 {
 
+// Identity of object written by writers, object and its first member share the address, so type is a part of the key
+struct ObjectKey
+{
+	const void* address;
+	rttr::Type type;
+
+	bool operator==(const ObjectKey& other) const
+	{
+		return address == other.address && type == other.type;
+	}
+};
+
+struct ObjectKeyHash
+{
+	std::size_t operator()(const ObjectKey& key) const
+	{
+		const std::size_t addressHash = std::hash<const void*>()(key.address);
+		return addressHash ^ (std::hash<rttr::Type>()(key.type) + static_cast<std::size_t>(0x9E3779B97F4A7C15ULL) + (addressHash << 6) + (addressHash >> 2));
+	}
+};
+
 /*
 * @brief Serialization context is an optional state of serialization process
 * 
@@ -17,6 +41,8 @@ namespace detail
 * - Temp variables need to handle indirect properties (for example properties defined with getter/setter pair
 * are first resolved into temp variable, and then that temp variable is assigned to the target using setter method,
 * and then temp variable can be discarded
+* - Temp variables are placed into bump arena which lives as long as the context, so creating one costs no heap allocation.
+* Arena is rewound when variables are destroyed in reverse creation order, and reset at once in ClearTempVariables
 */
 class SerializationContext
 {
@@ -42,8 +68,34 @@ public:
 	void RAVEN_SERIALIZE_API ClearTempVariables();
 
 private:
+	struct TempVariable
+	{
+		void* ptr;
+		rttr::Type type;
+		// Arena position before variable was allocated, to rewind to when it's released
+		std::size_t arenaBlockIdx;
+		std::size_t arenaOffset;
+		bool inArena;
+	};
+
+	void* AllocateFromArena(const std::size_t size, const std::size_t alignment);
+	void ReleaseTempVariable(const TempVariable& tempVar);
+	// Drops released variables from the end of the list and rewinds arena to the oldest of them
+	void PopReleasedTempVariables();
+
+private:
+	struct ArenaBlock
+	{
+		std::unique_ptr<std::max_align_t[]> memory;
+		std::size_t size;
+	};
+
 	std::unordered_map<uint64_t, ObjectData> m_objects;
-	std::unordered_map<void*, rttr::Type> m_tempVariables;
+	// Temp variables in creation order, released ones have null ptr until popped
+	std::vector<TempVariable> m_tempVariables;
+	std::vector<ArenaBlock> m_arenaBlocks;
+	std::size_t m_arenaBlockIdx = 0U;
+	std::size_t m_arenaOffset = 0U;
 };
 
 } // namespace detail
@@ -17,7 +17,7 @@ void CallObjectMutatorAction::Perform()
 {
 	auto objectPtrAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(m_object));
 	auto valuePtrAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(m_assignedValue));
-	Log::LogMessage("CallObjectMutatorAction performed. Object 0x%llX property '%s', value at 0x%llX", objectPtrAsInt, m_property->GetName(), valuePtrAsInt);
+	RS_LOG_TRACE("CallObjectMutatorAction performed. Object 0x%llX property '%s', value at 0x%llX", objectPtrAsInt, m_property->GetName(), valuePtrAsInt);
 
 	m_property->CallMutator(m_object, const_cast<void*>(m_assignedValue));
 }
@@ -6,7 +6,7 @@ namespace rs
 namespace detail
 {
 
-CollectionInsertAction::CollectionInsertAction(const std::size_t depth, std::unique_ptr<rttr::CollectionInserterBase>&& inserter, const void* value)
+CollectionInsertAction::CollectionInsertAction(const std::size_t depth, std::unique_ptr<rttr::CollectionInserterBase>&& inserter, void* value)
 	: IReaderAction(depth)
 	, m_value(value)
 	, m_inserter(std::move(inserter))
@@ -14,7 +14,8 @@ CollectionInsertAction::CollectionInsertAction(const std::size_t depth, std::uni
 
 void CollectionInsertAction::Perform()
 {
-	m_inserter->Insert(m_value);
+	// Value is a temp variable owned by this action only, so it can be moved from
+	m_inserter->InsertMove(m_value);
 }
 
 const ReaderActionType CollectionInsertAction::GetActionType() const
@@ -12,14 +12,14 @@ class CollectionInsertAction
 	: public IReaderAction
 {
 public:
-	explicit CollectionInsertAction(const std::size_t depth, std::unique_ptr<rttr::CollectionInserterBase>&& inserter, const void* value);
+	explicit CollectionInsertAction(const std::size_t depth, std::unique_ptr<rttr::CollectionInserterBase>&& inserter, void* value);
 
 	void Perform() final;
 	const ReaderActionType GetActionType() const final;
 
 private:
 	std::unique_ptr<rttr::CollectionInserterBase> m_inserter;
-	const void* m_value;
+	void* m_value;
 };
 
 } // namespace detail
@@ -24,12 +24,12 @@ void ResolvePointerAction::Perform()
 	if (nullptr != objectData)
 	{
 		auto pointerValueAsInt = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(objectData->objectPtr));
-		Log::LogMessage("ResolvePointerAction performed. Pointer at 0x%llX filled with address 0x%llX", pointerAsInt, pointerValueAsInt);
+		RS_LOG_TRACE("ResolvePointerAction performed. Pointer at 0x%llX filled with address 0x%llX", pointerAsInt, pointerValueAsInt);
 		rttr::AssignPointerValue(m_pointerAddress, objectData->objectPtr);
 	}
 	else
 	{
-		Log::LogMessage("ResolvePointerAction performed. Pointer at 0x%llX filled with address null", pointerAsInt);
+		RS_LOG_TRACE("ResolvePointerAction performed. Pointer at 0x%llX filled with address null", pointerAsInt);
 		rttr::AssignPointerValue(m_pointerAddress, nullptr);
 	}
 }
@@ -8,6 +8,8 @@ void BaseReader::Read(const rttr::Type& type, void* value)
 {
 	// Create serialization context so reader implementations will be able to use it
 	m_context = std::make_unique<rs::detail::SerializationContext>();
+	m_pendingContextObjects.clear();
+	m_visitedContextObjects.clear();
 
 	// Call read operation implementation
 	DoRead(type, value);
@@ -18,24 +20,34 @@ void BaseReader::Read(const rttr::Type& type, void* value)
 		action->Perform();
 	}
 
+	// Actions reference values of this read only
+	m_deferredCommandsList.clear();
+
 	// Release context
 	m_context.reset();
 }
 
-void BaseReader::FilterReferencedObjectsList(std::vector<std::pair<uint64_t, rttr::Type>>& objectsList)
+void BaseReader::EnqueueContextObject(const uint64_t objectId, const rttr::Type& type)
 {
-	for (auto it = objectsList.begin(); it != objectsList.end();)
+	if (m_visitedContextObjects.insert(objectId).second)
 	{
-		bool objectLoaded = !!m_context->GetObjectById(it->first);
-		if (objectLoaded)
-		{
-			it = objectsList.erase(it);
-		}
-		else
-		{
-			++it;
-		}
+		m_pendingContextObjects.emplace_back(objectId, type);
 	}
 }
 
+void BaseReader::MarkContextObjectVisited(const uint64_t objectId)
+{
+	m_visitedContextObjects.insert(objectId);
+}
+
+bool BaseReader::PopPendingContextObject(std::pair<uint64_t, rttr::Type>& objectReference)
+{
+	if (m_pendingContextObjects.empty())
+		return false;
+
+	objectReference = m_pendingContextObjects.front();
+	m_pendingContextObjects.pop_front();
+	return true;
+}
+
 }
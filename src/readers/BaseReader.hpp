@@ -2,11 +2,14 @@
 #include "readers/IReader.hpp"
 #include "rttr/Type.hpp"
 #include "actions/IReaderAction.hpp"
+#include "rs/SerializationAdapter.hpp"
 #include "SerializationContext.hpp"
 #include "ContextPath.hpp"
 
 #include <istream>
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include <json/json.h>
 
 namespace rs
@@ -22,8 +25,18 @@ public:
 	void RAVEN_SERIALIZE_API Read(const rttr::Type& type, void* value) final;
 
 protected:
-	// Removes data about objects that had already been loaded
-	void FilterReferencedObjectsList(std::vector<std::pair<uint64_t, rttr::Type>>& objectsList);
+	// Queues referenced context object for loading, every object id is queued at most once per read
+	void EnqueueContextObject(const uint64_t objectId, const rttr::Type& type);
+	// Marks object id as handled without queueing it, used for objects that are read explicitly (like master object)
+	void MarkContextObjectVisited(const uint64_t objectId);
+	// Pops the next context object to load in FIFO order, returns false when worklist is empty
+	bool PopPendingContextObject(std::pair<uint64_t, rttr::Type>& objectReference);
+
+	// Adapter reading shared by readers, data is accessed by callbacks in reader format:
+	// readPayload(payload) reads payload into payload.value if data has one, readValue(type, value) reads converted value,
+	// or skips it when adapter has no converted type and value is null
+	template <typename PayloadReader, typename ValueReader>
+	ReadResult ReadAdapterData(rs::SerializationAdapter* adapter, void* value, PayloadReader&& readPayload, ValueReader&& readValue);
 
 	virtual void DoRead(const rttr::Type& type, void* value) = 0;
 	virtual bool CheckSourceHasObjectsList() = 0;
@@ -31,11 +44,44 @@ protected:
 protected:
 	// Context is used to store the temp variables and objects ids mappings
 	std::unique_ptr<rs::detail::SerializationContext> m_context;
-	std::vector<std::pair<uint64_t, rttr::Type>> m_referencedContextObjects;
+	// Worklist of referenced context objects waiting to be loaded, and ids of all objects ever queued
+	std::deque<std::pair<uint64_t, rttr::Type>> m_pendingContextObjects;
+	std::unordered_set<uint64_t> m_visitedContextObjects;
 	// Deferred commands list is used to handle complex nested cases, when we read some deep property, up the tree there might be temp variables,
 	// and indirect properties, so to make sure everything will be in place, we remember operations, and after we execute them to get final result
 	std::vector<std::unique_ptr<detail::IReaderAction>> m_deferredCommandsList;
 	bool m_hasObjectsList = false;
 };
 
+template <typename PayloadReader, typename ValueReader>
+ReadResult BaseReader::ReadAdapterData(rs::SerializationAdapter* adapter, void* value, PayloadReader&& readPayload, ValueReader&& readValue)
+{
+	SerializationAdapter::DataChunk payload;
+	payload.type = adapter->GetPayloadType();
+
+	// Adapter isn't given partially read payload
+	ReadResult result = readPayload(payload);
+	if (!result.success)
+	{
+		readValue(rttr::Type(), nullptr);
+		return result;
+	}
+
+	// Perform adapter logic (payload can be empty)
+	SerializationAdapter::AdapterReadOutput adapterOutput = adapter->ReadConvert(payload);
+
+	if (!adapterOutput.convertedType.IsValid())
+	{
+		readValue(adapterOutput.convertedType, nullptr);
+		return ReadResult::GenericFailResult();
+	}
+
+	void* adapterValue = m_context->CreateTempVariable(adapterOutput.convertedType);
+	result.Merge(readValue(adapterOutput.convertedType, adapterValue));
+
+	adapter->ReadFinalize(adapterValue, value, adapterOutput, payload);
+
+	return result;
+}
+
 } // namespace rs
@@ -0,0 +1,1349 @@
+#include "readers/BinaryReader.hpp"
+#include "rttr/Property.hpp"
+#include "rttr/Manager.hpp"
+#include "rs/BinaryFormat.hpp"
+#include "rs/ByteOrder.hpp"
+#include "actions/CallObjectMutatorAction.hpp"
+#include "actions/ResolvePointerAction.hpp"
+#include "actions/CollectionInsertAction.hpp"
+
+#include <cstring>
+
+namespace rs
+{
+
+namespace binary = detail::binary;
+
+namespace
+{
+
+// Nesting of skipped values, deeper values are treated as malformed data
+constexpr std::size_t k_maxSkipDepth = 256U;
+
+}
+
+BinaryReader::BinaryReader(std::istream& stream)
+{
+	std::size_t startOffset = stream.tellg();
+
+	stream.seekg(0, std::ios::end);
+	std::size_t bufferSize = static_cast<std::size_t>(stream.tellg()) - startOffset;
+	stream.seekg(startOffset, std::ios::beg);
+
+	if (bufferSize > 0U)
+	{
+		std::string buffer(bufferSize, '\0');
+		stream.read(&buffer[0], bufferSize);
+		buffer.resize(static_cast<std::size_t>(stream.gcount()));
+
+		m_source = std::make_unique<MemoryInputSource>(std::move(buffer));
+		ReadHeader();
+	}
+
+	if (!m_isOk)
+	{
+		// Revert stream back to original offset
+		stream.clear();
+		stream.seekg(startOffset, std::ios::beg);
+	}
+}
+
+BinaryReader::BinaryReader(std::string content)
+	: m_source(std::make_unique<MemoryInputSource>(std::move(content)))
+{
+	ReadHeader();
+}
+
+BinaryReader::BinaryReader(std::unique_ptr<InputSource>&& source)
+	: m_source(std::move(source))
+{
+	ReadHeader();
+}
+
+void BinaryReader::ReadHeader()
+{
+	m_isOk = false;
+
+	if (!m_source || !m_source->IsOk() || m_source->GetSize() < binary::k_headerSize)
+	{
+		RS_LOG_ERROR("Binary data is too short!");
+		return;
+	}
+
+	const char* data = m_source->GetData();
+	if (std::memcmp(data, binary::k_magic, sizeof(binary::k_magic)) != 0 || static_cast<uint8_t>(data[3]) != binary::k_version)
+	{
+		RS_LOG_ERROR("Unsupported binary data format!");
+		return;
+	}
+
+	const bool isBigEndian = (static_cast<uint8_t>(data[4]) & binary::k_flagBigEndian) != 0U;
+	m_swapByteOrder = isBigEndian != (k_hostByteOrder == ByteOrder::BigEndian);
+
+	m_rootSchemaHash = binary::ReadUInt64(data + binary::k_schemaHashPosition);
+	m_cursor = data + binary::k_headerSize;
+	m_end = data + m_source->GetSize();
+
+	if ((static_cast<uint8_t>(data[4]) & binary::k_flagObjectsIndex) != 0U && !ReadObjectsIndexLocation())
+	{
+		RS_LOG_ERROR("Binary objects index is malformed!");
+		return;
+	}
+
+	// Schema table is only located here, it's parsed when reader types don't match written ones
+	uint64_t schemaSize = 0U;
+	if (!ReadVarUInt(schemaSize) || !ReadBytes(m_schemaData, schemaSize) || !ReadVarUInt(m_objectsCount))
+		return;
+
+	m_body = m_cursor;
+
+	if (m_objectsCount == 0U)
+	{
+		m_isOk = true;
+	}
+	else if (nullptr != m_objectsIndex)
+	{
+		// Objects are located through the index on demand, so objects list isn't parsed here
+		m_isOk = ReadVarUInt(m_masterObjectId) && m_objectsIndexSize == m_objectsCount;
+	}
+	else
+	{
+		m_isOk = IndexContextObjects();
+	}
+}
+
+bool BinaryReader::ReadObjectsIndexLocation()
+{
+	// Index offset is the last 8 bytes of data
+	const std::size_t dataSize = static_cast<std::size_t>(m_end - m_cursor);
+	if (dataSize < sizeof(uint64_t))
+		return false;
+
+	const char* indexEnd = m_end - sizeof(uint64_t);
+	const uint64_t indexOffset = binary::ReadUInt64(indexEnd);
+	const uint64_t indexBegin = static_cast<uint64_t>(m_cursor - m_source->GetData());
+	const uint64_t indexSize = static_cast<uint64_t>(indexEnd - m_source->GetData()) - indexOffset;
+
+	if (indexOffset < indexBegin || indexOffset > static_cast<uint64_t>(indexEnd - m_source->GetData()) || indexSize % binary::k_objectsIndexRecordSize != 0U)
+		return false;
+
+	m_objectsIndex = m_source->GetData() + indexOffset;
+	m_objectsIndexSize = indexSize / binary::k_objectsIndexRecordSize;
+	m_end = m_objectsIndex;
+
+	return true;
+}
+
+bool BinaryReader::IndexContextObjects()
+{
+	if (!ReadVarUInt(m_masterObjectId))
+		return false;
+
+	// Objects count can't exceed data size, as every object takes a few bytes at least
+	if (m_objectsCount > static_cast<uint64_t>(m_end - m_cursor))
+		return false;
+
+	m_contextObjectsIndex.reserve(static_cast<std::size_t>(m_objectsCount));
+
+	for (uint64_t i = 0U; i < m_objectsCount; ++i)
+	{
+		uint64_t objectId = 0U;
+		ContextObjectEntry entry;
+
+		if (!ReadContextObjectEntry(objectId, entry))
+		{
+			RS_LOG_ERROR("Binary objects list is truncated!");
+			return false;
+		}
+
+		m_contextObjectsIndex.emplace(objectId, entry);
+	}
+
+	return true;
+}
+
+bool BinaryReader::ReadContextObjectEntry(uint64_t& objectId, ContextObjectEntry& entry)
+{
+	uint64_t typeNameLength = 0U;
+	uint64_t objectSize = 0U;
+	std::string_view objectBytes;
+
+	if (!ReadVarUInt(objectId) || !ReadVarUInt(typeNameLength) || !ReadBytes(entry.typeName, typeNameLength) ||
+		!ReadVarUInt(entry.schemaNodeIdx) || !ReadVarUInt(objectSize) || !ReadBytes(objectBytes, objectSize))
+		return false;
+
+	entry.begin = objectBytes.data();
+	entry.end = objectBytes.data() + objectBytes.size();
+	return true;
+}
+
+const BinaryReader::ContextObjectEntry* BinaryReader::FindContextObject(const uint64_t objectId)
+{
+	if (!m_isOk)
+		return nullptr;
+
+	auto it = m_contextObjectsIndex.find(objectId);
+	if (it != m_contextObjectsIndex.end())
+		return &it->second;
+
+	if (nullptr == m_objectsIndex)
+		return nullptr;
+
+	// Binary search of the record, records are sorted by object id
+	uint64_t first = 0U;
+	uint64_t count = m_objectsIndexSize;
+
+	while (count > 0U)
+	{
+		const uint64_t step = count / 2U;
+		const uint64_t recordIdx = first + step;
+
+		if (binary::ReadUInt64(m_objectsIndex + recordIdx * binary::k_objectsIndexRecordSize) < objectId)
+		{
+			first = recordIdx + 1U;
+			count -= step + 1U;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	if (first == m_objectsIndexSize)
+		return nullptr;
+
+	const char* record = m_objectsIndex + first * binary::k_objectsIndexRecordSize;
+	const uint64_t objectOffset = binary::ReadUInt64(record + sizeof(uint64_t));
+
+	if (binary::ReadUInt64(record) != objectId || objectOffset < static_cast<uint64_t>(m_body - m_source->GetData()) ||
+		objectOffset >= static_cast<uint64_t>(m_objectsIndex - m_source->GetData()))
+		return nullptr;
+
+	// Entry is parsed in place, objects list ends where index starts
+	const char* savedCursor = m_cursor;
+	const char* savedEnd = m_end;
+
+	m_cursor = m_source->GetData() + objectOffset;
+	m_end = m_objectsIndex;
+
+	uint64_t entryObjectId = 0U;
+	ContextObjectEntry entry;
+	const bool isEntryValid = ReadContextObjectEntry(entryObjectId, entry) && entryObjectId == objectId;
+
+	m_cursor = savedCursor;
+	m_end = savedEnd;
+
+	if (!isEntryValid)
+	{
+		RS_LOG_ERROR("Binary objects index references malformed object!");
+		return nullptr;
+	}
+
+	return &m_contextObjectsIndex.emplace(objectId, entry).first->second;
+}
+
+void BinaryReader::ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const ContextObjectEntry& entry)
+{
+	m_cursor = entry.begin;
+	m_end = entry.end;
+
+	ReadResult objectReadResult = ReadTopLevel(entry.schemaNodeIdx, type, value);
+
+	if (objectReadResult.success)
+	{
+		m_context->AddObject(objectId, type, value);
+	}
+	else
+	{
+		RS_LOG_ERROR("Failed to read context object!");
+	}
+}
+
+void BinaryReader::DoRead(const rttr::Type& type, void* value)
+{
+	// Header failed to parse, so there is no body to read from
+	if (!m_isOk)
+	{
+		RS_LOG_ERROR("Binary data is malformed, nothing is read!");
+		return;
+	}
+
+	m_hasError = false;
+	m_hasObjectsList = (m_objectsCount > 0U);
+	// Header has master object hash only, objects read by id from data without schema table can't be checked
+	m_rootSchemaMatches = (m_requestedObjectId != 0U) ? m_schemaData.empty() : (m_rootSchemaHash == m_schemaHasher.GetHash(type));
+
+	if (m_hasObjectsList)
+	{
+		const uint64_t rootObjectId = (m_requestedObjectId != 0U) ? m_requestedObjectId : m_masterObjectId;
+
+		const ContextObjectEntry* rootObjectEntry = FindContextObject(rootObjectId);
+		if (nullptr != rootObjectEntry)
+		{
+			// Parse root object, it's marked as visited first, so references to it are not queued
+			MarkContextObjectVisited(rootObjectId);
+			ReadContextObject(type, value, rootObjectId, *rootObjectEntry);
+
+			// Handle referenced context objects, each of them is queued only once, so every object is loaded exactly one time
+			std::pair<uint64_t, rttr::Type> objectReference;
+			while (PopPendingContextObject(objectReference))
+			{
+				bool contextObjectValid = false;
+
+				const ContextObjectEntry* contextObjectEntry = FindContextObject(objectReference.first);
+				if (nullptr != contextObjectEntry)
+				{
+					rttr::Type pointedType = objectReference.second;
+
+					if (pointedType.IsValid())
+					{
+						// Type name is present only when actual object type differs from the pointer type
+						const std::string_view typeName = contextObjectEntry->typeName;
+						if (!typeName.empty())
+						{
+							rttr::Type deducedType = rttr::Reflect(std::string(typeName).c_str());
+							if (deducedType.IsValid() && deducedType.IsBaseClass(pointedType))
+							{
+								pointedType = deducedType;
+							}
+						}
+
+						void* pointedValue = pointedType.Instantiate();
+						if (nullptr != pointedValue)
+						{
+							m_hasError = false;
+							ReadContextObject(pointedType, pointedValue, objectReference.first, *contextObjectEntry);
+							contextObjectValid = true;
+						}
+					}
+				}
+
+				if (!contextObjectValid)
+				{
+					m_context->AddObject(objectReference.first, objectReference.second, nullptr);
+				}
+			}
+		}
+		else
+		{
+			RS_LOG_ERROR("Master object not found in the context objects list!");
+		}
+	}
+	else
+	{
+		// We have single object, simply read it here
+		m_cursor = m_body;
+		m_end = m_source->GetData() + m_source->GetSize();
+
+		ReadTopLevel(0U, type, value);
+	}
+}
+
+bool BinaryReader::ReadById(const uint64_t objectId, const rttr::Type& type, void* value)
+{
+	if (!m_isOk || objectId == 0U || nullptr == FindContextObject(objectId))
+		return false;
+
+	m_requestedObjectId = objectId;
+	Read(type, value);
+	m_requestedObjectId = 0U;
+
+	return true;
+}
+
+bool BinaryReader::CheckSourceHasObjectsList()
+{
+	return m_isOk && m_objectsCount > 0U;
+}
+
+ReadResult BinaryReader::ReadObject(const rttr::Type& type, void* value)
+{
+	// Plain data objects are copied as is
+	if (type.IsBlittable())
+	{
+		return ReadRaw(type, value, 1U);
+	}
+
+	ReadResult result = ReadResult::OKResult();
+
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+	{
+		ReadResult baseReadResult = ReadImpl(baseClassesInfo.first[i], value);
+		result.Merge(baseReadResult);
+	}
+
+	// Properties are read by position, as type has the same schema as written one
+	const std::size_t propertiesCount = type.GetPropertiesCount();
+	for (std::size_t i = 0U; i < propertiesCount; ++i)
+	{
+		ReadResult propertyReadResult = ReadProperty(type, type.GetProperty(i), value, binary::SchemaTable::k_noNode);
+
+		if (m_hasError)
+		{
+			return propertyReadResult;
+		}
+
+		if (!propertyReadResult.allEntitiesResolved)
+		{
+			// Notify calling code that not all entities are resolved for this object
+			result.allEntitiesResolved = false;
+		}
+	}
+
+	// Read collection items if this type is a collection
+	if (type.IsCollection())
+	{
+		ReadResult collectionReadResult = ReadCollection(type, value, binary::SchemaTable::k_noNode);
+		result.Merge(collectionReadResult);
+	}
+
+	return result;
+}
+
+ReadResult BinaryReader::ReadProperty(const rttr::Type& type, rttr::Property* property, void* value, const uint64_t schemaNodeIdx)
+{
+	const rttr::Type& propertyType = property->GetType();
+
+	RS_LOG_TRACE("Reading property '%s::%s'", type.GetName(), property->GetName());
+
+	// Decide to create temp variable or not
+	void* propertyValuePtr = nullptr;
+	bool needsTempVar = property->NeedsTempVariable();
+
+	if (needsTempVar)
+	{
+		propertyValuePtr = m_context->CreateTempVariable(property->GetType());
+	}
+	else
+	{
+		propertyValuePtr = property->GetValueAddress(value);
+	}
+
+	// Read value
+	ReadResult propertyReadResult = ReadWithSchema(schemaNodeIdx, propertyType, propertyValuePtr);
+
+	if (propertyReadResult.Succeeded())
+	{
+		// We have succeeded, now call property mutator function to apply temp
+		property->CallMutator(value, const_cast<void*>(propertyValuePtr));
+
+		// As we already applied value to target, we can release temp variable
+		if (needsTempVar)
+		{
+			m_context->DestroyTempVariable(propertyValuePtr);
+		}
+	}
+	else if (!m_hasError && !propertyReadResult.allEntitiesResolved)
+	{
+		// If not all property value entities are resolved, make use of deferred commands list
+		auto callMutatorAction = std::make_unique<detail::CallObjectMutatorAction>(0, property, value, propertyValuePtr);
+		m_deferredCommandsList.push_back(std::move(callMutatorAction));
+	}
+
+	return propertyReadResult;
+}
+
+ReadResult BinaryReader::ReadCollection(const rttr::Type& type, void* value, const uint64_t itemSchemaNodeIdx)
+{
+	uint64_t itemsCount = 0U;
+	if (!ReadVarUInt(itemsCount))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	// Every item takes one byte at least, so count can be checked before anything is allocated
+	if (itemsCount > static_cast<uint64_t>(m_end - m_cursor))
+	{
+		return Fail("Collection items count exceeds data size!");
+	}
+
+	ReadResult result = ReadResult::OKResult();
+	const rttr::Type collectionItemType = type.GetCollectionItemType();
+
+	if (itemsCount == 0U)
+	{
+		return result;
+	}
+
+	// Items of the same schema are read by position, it's checked once for all items
+	uint64_t itemNodeIdx = binary::SchemaTable::k_noNode;
+	if (itemSchemaNodeIdx != binary::SchemaTable::k_noNode)
+	{
+		const binary::SchemaTable::Node* itemNode = GetSchemaNode(itemSchemaNodeIdx);
+		if (nullptr == itemNode)
+		{
+			return ReadResult::GenericFailResult();
+		}
+
+		if (!collectionItemType.IsValid() || itemNode->hash != m_schemaHasher.GetHash(collectionItemType))
+		{
+			itemNodeIdx = itemSchemaNodeIdx;
+		}
+	}
+
+	// Contiguous items of plain data are copied at once
+	if (itemNodeIdx == binary::SchemaTable::k_noNode && collectionItemType.IsBlittable() && type.IsContiguousCollection())
+	{
+		if (itemsCount * collectionItemType.GetSize() > static_cast<uint64_t>(m_end - m_cursor))
+		{
+			return Fail("Unexpected end of data!");
+		}
+
+		void* items = type.AppendCollectionItems(value, static_cast<std::size_t>(itemsCount));
+		if (nullptr == items)
+		{
+			return Fail("Collection can't hold all items!");
+		}
+
+		return ReadRaw(collectionItemType, items, static_cast<std::size_t>(itemsCount));
+	}
+
+	std::unique_ptr<rttr::CollectionInserterBase> inserter = type.CreateCollectionInserter(value);
+	if (!inserter || !collectionItemType.IsValid())
+	{
+		return Fail("Collection items can't be inserted!");
+	}
+
+	type.ReserveCollection(value, static_cast<std::size_t>(itemsCount));
+	inserter->SetReservedItemsCount(static_cast<std::size_t>(itemsCount));
+
+	for (uint64_t i = 0U; i < itemsCount; ++i)
+	{
+		RS_LOG_TRACE("Reading collection item %llu", static_cast<unsigned long long>(i));
+
+		// Prefer reading straight into collection storage, it saves temp object and a copy per item
+		void* collectionItem = inserter->Emplace();
+		if (nullptr != collectionItem)
+		{
+			ReadResult itemReadResult = ReadWithSchema(itemNodeIdx, collectionItemType, collectionItem);
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Item stays in place, deferred actions will complete it
+				result.allEntitiesResolved = false;
+			}
+			else if (!itemReadResult.success)
+			{
+				RS_LOG_ERROR("Collection item failed to be read!");
+				inserter->CancelEmplace();
+			}
+		}
+		else
+		{
+			collectionItem = m_context->CreateTempVariable(collectionItemType);
+			ReadResult itemReadResult = ReadWithSchema(itemNodeIdx, collectionItemType, collectionItem);
+
+			if (itemReadResult.Succeeded())
+			{
+				// Item read successfully, so we can safely insert here and release item temp variable
+				inserter->InsertMove(collectionItem);
+				m_context->DestroyTempVariable(collectionItem);
+			}
+			else if (!m_hasError && !itemReadResult.allEntitiesResolved)
+			{
+				// Notify caller that not all entities are resolved, and we must now defer actions using commands list
+				result.allEntitiesResolved = false;
+
+				auto insertAction = std::make_unique<detail::CollectionInsertAction>(0, type.CreateCollectionInserter(value), collectionItem);
+				m_deferredCommandsList.push_back(std::move(insertAction));
+			}
+			else
+			{
+				RS_LOG_ERROR("Collection item failed to be read!");
+			}
+		}
+
+		if (m_hasError)
+		{
+			return ReadResult::GenericFailResult();
+		}
+	}
+
+	return result;
+}
+
+ReadResult BinaryReader::ReadPointer(const rttr::Type& type, void* value)
+{
+	uint64_t objectId = 0U;
+	if (!ReadVarUInt(objectId))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	if (objectId == 0U)
+	{
+		// Resolve null pointer
+		rttr::AssignPointerValue(value, nullptr);
+		return ReadResult::OKResult();
+	}
+
+	if (!m_hasObjectsList)
+	{
+		return Fail("Pointer references an object, but data has no objects list!");
+	}
+
+	EnqueueContextObject(objectId, type.GetPointedType());
+
+	ReadResult result = ReadResult::OKResult();
+
+	// If we have resolved pointer address right now, use it
+	auto referencedObjectData = m_context->GetObjectById(objectId);
+	if (nullptr != referencedObjectData)
+	{
+		rttr::AssignPointerValue(value, referencedObjectData->objectPtr);
+	}
+	else
+	{
+		// Pointer can't be resolved right now, so put resolve action into deferred commands list
+		auto resolvePtrAction = std::make_unique<detail::ResolvePointerAction>(0, m_context.get(), value, objectId);
+		m_deferredCommandsList.push_back(std::move(resolvePtrAction));
+
+		result.allEntitiesResolved = false;
+	}
+
+	return result;
+}
+
+ReadResult BinaryReader::ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value)
+{
+	if (!proxyTypeData->readConverter)
+	{
+		return Fail("Type has proxy type, but no read converter defined!");
+	}
+
+	// Create proxy object
+	void* proxyObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+
+	// Read proxy object
+	ReadResult result = ReadImpl(proxyTypeData->proxyType, proxyObject);
+
+	// Create target object using proxy constructor
+	proxyTypeData->readConverter->Convert(value, proxyObject);
+
+	return result;
+}
+
+ReadResult BinaryReader::ReadAdapter(rs::SerializationAdapter* adapter, void* value)
+{
+	std::string_view flagsBytes;
+	if (!ReadBytes(flagsBytes, 1U))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	const uint8_t flags = static_cast<uint8_t>(flagsBytes[0]);
+
+	auto readPayload = [&](SerializationAdapter::DataChunk& payload)
+	{
+		if ((flags & binary::k_adapterPayload) == 0U)
+			return ReadResult::OKResult();
+
+		if (!payload.type.IsValid())
+			return Fail("Adapter payload is present, but adapter has no payload type!");
+
+		payload.value = m_context->CreateTempVariable(payload.type);
+		return ReadImpl(payload.type, payload.value);
+	};
+
+	auto readValue = [&](const rttr::Type& type, void* adapterValue)
+	{
+		if ((flags & binary::k_adapterValue) == 0U)
+		{
+			// Missing value is finalized from default constructed one, as json readers do with empty object
+			return (nullptr != adapterValue) ? ReadResult::OKResult() : ReadResult::GenericFailResult();
+		}
+
+		// Value data can't be skipped without its type
+		if (nullptr == adapterValue)
+			return Fail("Adapter value is present, but it can't be read as converted type!");
+
+		return ReadImpl(type, adapterValue);
+	};
+
+	return ReadAdapterData(adapter, value, readPayload, readValue);
+}
+
+ReadResult BinaryReader::ReadArray(const rttr::Type& type, void* value)
+{
+	rttr::Type arrayType = type.GetArrayType();
+	uint8_t* arrayBytePtr = static_cast<uint8_t*>(value);
+	std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	// Arrays of plain data are copied at once
+	if (arrayType.IsBlittable())
+	{
+		return ReadRaw(arrayType, value, totalSize);
+	}
+
+	ReadResult result = ReadResult::OKResult();
+
+	for (std::size_t i = 0U; i < totalSize; ++i)
+	{
+		ReadResult itemResult = ReadImpl(arrayType, arrayBytePtr + itemSize * i);
+
+		if (m_hasError)
+		{
+			return itemResult;
+		}
+
+		if (!itemResult.allEntitiesResolved)
+		{
+			result.allEntitiesResolved = false;
+		}
+	}
+
+	return result;
+}
+
+ReadResult BinaryReader::ReadIntegral(const rttr::Type& type, void* value)
+{
+	const std::size_t size = type.GetSize();
+
+	if (size == 1U)
+	{
+		std::string_view bytes;
+		if (!ReadBytes(bytes, 1U))
+		{
+			return Fail("Unexpected end of data!");
+		}
+
+		if (type.GetTypeIndex() == typeid(bool))
+		{
+			*static_cast<bool*>(value) = (bytes[0] != 0);
+		}
+		else
+		{
+			std::memcpy(value, bytes.data(), 1U);
+		}
+
+		return ReadResult::OKResult();
+	}
+
+	uint64_t encodedValue = 0U;
+	if (!ReadVarUInt(encodedValue))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	if (type.IsSignedIntegral())
+	{
+		const int64_t intValue = binary::ZigZagDecode(encodedValue);
+
+		switch (size)
+		{
+		case 2:
+			*static_cast<int16_t*>(value) = static_cast<int16_t>(intValue);
+			break;
+		case 4:
+			*static_cast<int32_t*>(value) = static_cast<int32_t>(intValue);
+			break;
+		case 8:
+		default:
+			*static_cast<int64_t*>(value) = intValue;
+			break;
+		}
+	}
+	else
+	{
+		switch (size)
+		{
+		case 2:
+			*static_cast<uint16_t*>(value) = static_cast<uint16_t>(encodedValue);
+			break;
+		case 4:
+			*static_cast<uint32_t*>(value) = static_cast<uint32_t>(encodedValue);
+			break;
+		case 8:
+		default:
+			*static_cast<uint64_t*>(value) = encodedValue;
+			break;
+		}
+	}
+
+	return ReadResult::OKResult();
+}
+
+ReadResult BinaryReader::ReadRaw(const rttr::Type& type, void* value, const std::size_t count)
+{
+	std::string_view bytes;
+	if (!ReadBytes(bytes, type.GetSize() * count))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	std::memcpy(value, bytes.data(), bytes.size());
+
+	if (m_swapByteOrder)
+	{
+		SwapBlittableByteOrder(type, value, count);
+	}
+
+	return ReadResult::OKResult();
+}
+
+ReadResult BinaryReader::ReadStdString(void* value)
+{
+	uint64_t length = 0U;
+	std::string_view str;
+
+	if (!ReadVarUInt(length) || !ReadBytes(str, length))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	static_cast<std::string*>(value)->assign(str.data(), str.size());
+	return ReadResult::OKResult();
+}
+
+ReadResult BinaryReader::ReadCString(void* value)
+{
+	char** strSerializedValue = reinterpret_cast<char**>(value);
+
+	// Length is shifted by one, zero means null string
+	uint64_t length = 0U;
+	if (!ReadVarUInt(length))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	if (length == 0U)
+	{
+		*strSerializedValue = nullptr;
+		return ReadResult::OKResult();
+	}
+
+	std::string_view str;
+	if (!ReadBytes(str, length - 1U))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	const std::string& storedStr = m_cStringsStorage.emplace_back(str);
+	*strSerializedValue = const_cast<char*>(storedStr.c_str());
+	return ReadResult::OKResult();
+}
+
+ReadResult BinaryReader::ReadImpl(const rttr::Type& type, void* value)
+{
+	if (m_hasError || !m_isOk)
+	{
+		return ReadResult::GenericFailResult();
+	}
+
+	// Predefined types are resolved with codec slot of the type
+	switch (type.GetPredefinedType())
+	{
+	case rs::PredefinedType::StdString:
+		return ReadStdString(value);
+	case rs::PredefinedType::CString:
+		return ReadCString(value);
+	default:
+		break;
+	}
+
+	switch (type.GetSerializationMethod())
+	{
+	case rs::SerializationMethod::Proxy:
+	{
+		rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+		if (nullptr != proxyTypeData)
+		{
+			return ReadProxy(proxyTypeData, value);
+		}
+	}
+	break;
+	case rs::SerializationMethod::Adapter:
+	{
+		SerializationAdapter* adapter = type.GetSerializationAdapter();
+		if (nullptr != adapter)
+		{
+			return ReadAdapter(adapter, value);
+		}
+	}
+	break;
+	default:
+	{
+		switch (type.GetTypeClass())
+		{
+		case rttr::TypeClass::Object:
+			return ReadObject(type, value);
+		case rttr::TypeClass::Pointer:
+			return ReadPointer(type, value);
+		case rttr::TypeClass::Enum:
+			return ReadImpl(type.GetEnumUnderlyingType(), value);
+		case rttr::TypeClass::Real:
+			return ReadRaw(type, value, 1U);
+		case rttr::TypeClass::Integral:
+			return ReadIntegral(type, value);
+		case rttr::TypeClass::Array:
+			return ReadArray(type, value);
+		default:
+			break;
+		}
+	}
+	break;
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult BinaryReader::ReadWithSchema(const uint64_t schemaNodeIdx, const rttr::Type& type, void* value)
+{
+	if (schemaNodeIdx == binary::SchemaTable::k_noNode)
+		return ReadImpl(type, value);
+
+	const binary::SchemaTable::Node* node = GetSchemaNode(schemaNodeIdx);
+	if (nullptr == node)
+	{
+		return ReadResult::GenericFailResult();
+	}
+
+	if (node->hash == m_schemaHasher.GetHash(type))
+	{
+		return ReadImpl(type, value);
+	}
+
+	return ReadMismatched(schemaNodeIdx, type, value);
+}
+
+ReadResult BinaryReader::ReadTopLevel(const uint64_t schemaNodeIdx, const rttr::Type& type, void* value)
+{
+	if (schemaNodeIdx == 0U && m_rootSchemaHash == m_schemaHasher.GetHash(type))
+	{
+		return ReadImpl(type, value);
+	}
+
+	// Data without schema table is read by position only, if root type is the same
+	if (m_schemaData.empty())
+	{
+		if (!m_rootSchemaMatches)
+		{
+			return Fail("Binary data is written with other types and has no schema table!");
+		}
+
+		return ReadImpl(type, value);
+	}
+
+	return ReadWithSchema(schemaNodeIdx, type, value);
+}
+
+ReadResult BinaryReader::ReadMismatched(const uint64_t schemaNodeIdx, const rttr::Type& type, void* value)
+{
+	if (m_hasError)
+	{
+		return ReadResult::GenericFailResult();
+	}
+
+	const binary::SchemaTable::Node& node = *m_schemaTable.GetNode(schemaNodeIdx);
+
+	// Values of proxy types are written as their proxy values
+	if (type.GetPredefinedType() == rs::PredefinedType::None && type.GetSerializationMethod() == rs::SerializationMethod::Proxy)
+	{
+		rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+		if (nullptr == proxyTypeData || !proxyTypeData->readConverter)
+		{
+			return Fail("Type has proxy type, but no read converter defined!");
+		}
+
+		void* proxyObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+		ReadResult result = ReadMismatched(schemaNodeIdx, proxyTypeData->proxyType, proxyObject);
+
+		if (result.Succeeded())
+		{
+			proxyTypeData->readConverter->Convert(value, proxyObject);
+		}
+
+		return result;
+	}
+
+	const binary::SchemaKind kind = binary::GetSchemaKind(type);
+	const bool isObject = (kind == binary::SchemaKind::Object || kind == binary::SchemaKind::BlittableObject);
+
+	switch (node.kind)
+	{
+	case binary::SchemaKind::Object:
+	{
+		if (isObject)
+			return ReadObjectFields(node, type, value);
+	}
+	break;
+	case binary::SchemaKind::BlittableObject:
+	{
+		if (isObject)
+			return ReadBlittableObjectFields(node, type, value);
+	}
+	break;
+	case binary::SchemaKind::Array:
+	{
+		if (kind == binary::SchemaKind::Array)
+			return ReadArrayItems(node, type, value);
+	}
+	break;
+	case binary::SchemaKind::Byte:
+	case binary::SchemaKind::SignedVarInt:
+	case binary::SchemaKind::UnsignedVarInt:
+	case binary::SchemaKind::String:
+	case binary::SchemaKind::CString:
+	case binary::SchemaKind::Pointer:
+	{
+		// Integers of other size and pointers to changed types are encoded the same way
+		if (kind == node.kind)
+			return ReadImpl(type, value);
+	}
+	break;
+	case binary::SchemaKind::Raw:
+	{
+		if (kind == node.kind && type.GetTypeClass() == rttr::TypeClass::Real && type.GetSize() == node.size)
+			return ReadImpl(type, value);
+	}
+	break;
+	default:
+		break;
+	}
+
+	RS_LOG_DEBUG("Written value doesn't match type '%s', it's skipped", type.GetName());
+
+	if (!SkipValue(schemaNodeIdx, 0U))
+	{
+		return Fail("Written value can't be skipped!");
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult BinaryReader::ReadObjectFields(const binary::SchemaTable::Node& node, const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::OKResult();
+
+	// Bases are matched by name, as they are written at the same address as the object
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	for (const uint64_t baseNodeIdx : node.bases)
+	{
+		const std::string_view baseName = m_schemaTable.GetNode(baseNodeIdx)->name;
+
+		rttr::Type baseType;
+		for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+		{
+			if (baseName == baseClassesInfo.first[i].GetName())
+			{
+				baseType = baseClassesInfo.first[i];
+				break;
+			}
+		}
+
+		if (!baseType.IsValid())
+		{
+			if (!SkipValue(baseNodeIdx, 0U))
+				return Fail("Written base class can't be skipped!");
+
+			continue;
+		}
+
+		ReadResult baseReadResult = ReadWithSchema(baseNodeIdx, baseType, value);
+		if (m_hasError)
+		{
+			return baseReadResult;
+		}
+
+		result.Merge(baseReadResult);
+	}
+
+	for (const binary::SchemaTable::Property& writtenProperty : node.properties)
+	{
+		const std::size_t propertyIdx = type.FindPropertyIndex(writtenProperty.name);
+		if (propertyIdx == rttr::k_invalidPropertyIndex)
+		{
+			RS_LOG_DEBUG("Written property '%.*s' is missing in type '%s', it's skipped", static_cast<int>(writtenProperty.name.size()),
+				writtenProperty.name.data(), type.GetName());
+
+			if (!SkipValue(writtenProperty.nodeIdx, 0U))
+				return Fail("Written property can't be skipped!");
+
+			continue;
+		}
+
+		ReadResult propertyReadResult = ReadProperty(type, type.GetProperty(propertyIdx), value, writtenProperty.nodeIdx);
+
+		if (m_hasError)
+		{
+			return propertyReadResult;
+		}
+
+		if (!propertyReadResult.allEntitiesResolved)
+		{
+			result.allEntitiesResolved = false;
+		}
+	}
+
+	if (node.itemNodeIdx != binary::SchemaTable::k_noNode)
+	{
+		if (type.IsCollection())
+		{
+			ReadResult collectionReadResult = ReadCollection(type, value, node.itemNodeIdx);
+			result.Merge(collectionReadResult);
+		}
+		else
+		{
+			// Type isn't a collection anymore, items are skipped together with their count
+			uint64_t itemsCount = 0U;
+			if (!ReadVarUInt(itemsCount))
+				return Fail("Unexpected end of data!");
+
+			for (uint64_t i = 0U; i < itemsCount; ++i)
+			{
+				const char* itemBegin = m_cursor;
+				if (!SkipValue(node.itemNodeIdx, 0U))
+					return Fail("Written collection items can't be skipped!");
+
+				// Items encoded with no bytes at all are all skipped already
+				if (m_cursor == itemBegin)
+					break;
+			}
+		}
+	}
+
+	return result;
+}
+
+ReadResult BinaryReader::ReadBlittableObjectFields(const binary::SchemaTable::Node& node, const rttr::Type& type, void* value)
+{
+	std::string_view bytes;
+	if (node.size > static_cast<uint64_t>(m_end - m_cursor) || !ReadBytes(bytes, static_cast<std::size_t>(node.size)))
+	{
+		return Fail("Unexpected end of data!");
+	}
+
+	// Members are copied from written object bytes, if their types are the same
+	for (const binary::SchemaTable::Property& writtenProperty : node.properties)
+	{
+		const std::size_t propertyIdx = type.FindPropertyIndex(writtenProperty.name);
+		if (propertyIdx == rttr::k_invalidPropertyIndex)
+			continue;
+
+		rttr::Property* property = type.GetProperty(propertyIdx);
+		const rttr::Type& propertyType = property->GetType();
+		const binary::SchemaTable::Node* propertyNode = m_schemaTable.GetNode(writtenProperty.nodeIdx);
+
+		if (!propertyType.IsBlittable() || propertyNode->hash != m_schemaHasher.GetHash(propertyType) ||
+			writtenProperty.offset > bytes.size() || propertyType.GetSize() > bytes.size() - writtenProperty.offset)
+		{
+			RS_LOG_DEBUG("Written member '%s::%s' doesn't match, it's skipped", type.GetName(), property->GetName());
+			continue;
+		}
+
+		const bool needsTempVar = property->NeedsTempVariable();
+		void* propertyValuePtr = needsTempVar ? m_context->CreateTempVariable(propertyType) : property->GetValueAddress(value);
+
+		std::memcpy(propertyValuePtr, bytes.data() + writtenProperty.offset, propertyType.GetSize());
+		if (m_swapByteOrder)
+		{
+			SwapBlittableByteOrder(propertyType, propertyValuePtr, 1U);
+		}
+
+		property->CallMutator(value, propertyValuePtr);
+
+		if (needsTempVar)
+		{
+			m_context->DestroyTempVariable(propertyValuePtr);
+		}
+	}
+
+	return ReadResult::OKResult();
+}
+
+ReadResult BinaryReader::ReadArrayItems(const binary::SchemaTable::Node& node, const rttr::Type& type, void* value)
+{
+	const rttr::Type arrayType = type.GetArrayType();
+	uint8_t* arrayBytePtr = static_cast<uint8_t*>(value);
+	const std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	ReadResult result = ReadResult::OKResult();
+
+	// Items are matched by position, written items beyond array size are skipped
+	for (uint64_t i = 0U; i < node.size; ++i)
+	{
+		if (i >= totalSize)
+		{
+			const char* itemBegin = m_cursor;
+			if (!SkipValue(node.itemNodeIdx, 0U))
+				return Fail("Written array items can't be skipped!");
+
+			if (m_cursor == itemBegin)
+				break;
+
+			continue;
+		}
+
+		ReadResult itemResult = ReadWithSchema(node.itemNodeIdx, arrayType, arrayBytePtr + itemSize * static_cast<std::size_t>(i));
+
+		if (m_hasError)
+		{
+			return itemResult;
+		}
+
+		if (!itemResult.allEntitiesResolved)
+		{
+			result.allEntitiesResolved = false;
+		}
+	}
+
+	return result;
+}
+
+bool BinaryReader::SkipValue(const uint64_t schemaNodeIdx, const std::size_t depth)
+{
+	const binary::SchemaTable::Node* node = m_schemaTable.GetNode(schemaNodeIdx);
+	if (nullptr == node || depth > k_maxSkipDepth)
+		return false;
+
+	std::string_view bytes;
+	uint64_t encodedValue = 0U;
+
+	switch (node->kind)
+	{
+	case binary::SchemaKind::Byte:
+		return ReadBytes(bytes, 1U);
+	case binary::SchemaKind::SignedVarInt:
+	case binary::SchemaKind::UnsignedVarInt:
+	case binary::SchemaKind::Pointer:
+		return ReadVarUInt(encodedValue);
+	case binary::SchemaKind::Raw:
+	case binary::SchemaKind::BlittableObject:
+		return node->size <= static_cast<uint64_t>(m_end - m_cursor) && ReadBytes(bytes, static_cast<std::size_t>(node->size));
+	case binary::SchemaKind::String:
+		return ReadVarUInt(encodedValue) && encodedValue <= static_cast<uint64_t>(m_end - m_cursor) && ReadBytes(bytes, static_cast<std::size_t>(encodedValue));
+	case binary::SchemaKind::CString:
+	{
+		// Length is shifted by one, zero means null string
+		if (!ReadVarUInt(encodedValue))
+			return false;
+
+		return encodedValue == 0U || (encodedValue - 1U <= static_cast<uint64_t>(m_end - m_cursor) && ReadBytes(bytes, static_cast<std::size_t>(encodedValue - 1U)));
+	}
+	case binary::SchemaKind::Array:
+	{
+		for (uint64_t i = 0U; i < node->size; ++i)
+		{
+			const char* itemBegin = m_cursor;
+			if (!SkipValue(node->itemNodeIdx, depth + 1U))
+				return false;
+
+			// Items encoded with no bytes at all are all skipped already
+			if (m_cursor == itemBegin)
+				break;
+		}
+
+		return true;
+	}
+	case binary::SchemaKind::Object:
+	{
+		for (const uint64_t baseNodeIdx : node->bases)
+		{
+			if (!SkipValue(baseNodeIdx, depth + 1U))
+				return false;
+		}
+
+		for (const binary::SchemaTable::Property& property : node->properties)
+		{
+			if (!SkipValue(property.nodeIdx, depth + 1U))
+				return false;
+		}
+
+		if (node->itemNodeIdx == binary::SchemaTable::k_noNode)
+			return true;
+
+		uint64_t itemsCount = 0U;
+		if (!ReadVarUInt(itemsCount))
+			return false;
+
+		for (uint64_t i = 0U; i < itemsCount; ++i)
+		{
+			const char* itemBegin = m_cursor;
+			if (!SkipValue(node->itemNodeIdx, depth + 1U))
+				return false;
+
+			if (m_cursor == itemBegin)
+				break;
+		}
+
+		return true;
+	}
+	default:
+		// Adapter values depend on adapter logic, so they can't be skipped
+		return false;
+	}
+}
+
+const binary::SchemaTable::Node* BinaryReader::GetSchemaNode(const uint64_t schemaNodeIdx)
+{
+	// Table is parsed once, on first value which schema differs from reader type one
+	if (!m_schemaTableRequested)
+	{
+		m_schemaTableRequested = true;
+
+		if (!m_schemaTable.Parse(m_schemaData.data(), m_schemaData.size()))
+		{
+			RS_LOG_ERROR("Binary schema table is malformed!");
+		}
+	}
+
+	const binary::SchemaTable::Node* node = m_schemaTable.GetNode(schemaNodeIdx);
+	if (nullptr == node)
+	{
+		Fail("Written schema doesn't describe the value!");
+	}
+
+	return node;
+}
+
+bool BinaryReader::ReadVarUInt(uint64_t& value)
+{
+	if (!binary::ReadVarUInt(m_cursor, m_end, value))
+	{
+		m_hasError = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool BinaryReader::ReadBytes(std::string_view& bytes, const std::size_t size)
+{
+	if (static_cast<std::size_t>(m_end - m_cursor) < size)
+	{
+		m_hasError = true;
+		return false;
+	}
+
+	bytes = std::string_view(m_cursor, size);
+	m_cursor += size;
+	return true;
+}
+
+ReadResult BinaryReader::Fail(const char* message)
+{
+	RS_LOG_ERROR("%s", message);
+
+	m_hasError = true;
+	return ReadResult::GenericFailResult();
+}
+
+bool BinaryReader::IsOk() const
+{
+	return m_isOk;
+}
+
+} // namespace rs
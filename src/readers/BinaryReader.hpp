@@ -0,0 +1,133 @@
+#pragma once
+#include "readers/BaseReader.hpp"
+#include "readers/InputSource.hpp"
+#include "rttr/Type.hpp"
+#include "rs/BinarySchema.hpp"
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+
+namespace rs
+{
+
+/*
+* @brief Compact binary reader implementation, reads data produced by BinaryWriter
+*
+* Values are decoded straight from source memory by their meta type. Raw values written on a host with
+* different byte order are swapped after copying. Any malformed or truncated data stops reading.
+* Values of types with the same schema hash as written ones are read by position. Otherwise written schema table is parsed,
+* and objects are read field by field: bases and properties are matched by name, written values missing in reader types
+* and values of incompatible types are skipped.
+* Archives with objects index are accessed randomly: any context object is read by id along with objects it references,
+* objects are located through the index, so other objects are not even touched, what makes memory mapped sources cheap.
+*/
+class BinaryReader
+	: public BaseReader
+{
+public:
+	explicit RAVEN_SERIALIZE_API BinaryReader(std::istream& stream);
+	explicit RAVEN_SERIALIZE_API BinaryReader(std::string content);
+	// Reads directly from source memory, for example from MappedFileInputSource, source is kept alive by the reader
+	explicit RAVEN_SERIALIZE_API BinaryReader(std::unique_ptr<InputSource>&& source);
+	RAVEN_SERIALIZE_API ~BinaryReader() = default;
+
+	bool RAVEN_SERIALIZE_API IsOk() const final;
+
+	// Reads context object with given id and objects it references, instead of the master object
+	// Returns false if there is no such object
+	bool RAVEN_SERIALIZE_API ReadById(const uint64_t objectId, const rttr::Type& type, void* value);
+
+	template <typename T>
+	bool TypedReadById(const uint64_t objectId, T& value)
+	{
+		return ReadById(objectId, rttr::Reflect<T>(), &value);
+	}
+
+protected:
+	void DoRead(const rttr::Type& type, void* value) final;
+	bool CheckSourceHasObjectsList() final;
+
+private:
+	struct ContextObjectEntry
+	{
+		std::string_view typeName;
+		uint64_t schemaNodeIdx;
+		const char* begin;
+		const char* end;
+	};
+
+	void ReadHeader();
+	bool ReadObjectsIndexLocation();
+	bool IndexContextObjects();
+	// Reads objects list entry at cursor
+	bool ReadContextObjectEntry(uint64_t& objectId, ContextObjectEntry& entry);
+	// Finds entry in objects index lazily, if archive has one, entries are cached
+	const ContextObjectEntry* FindContextObject(const uint64_t objectId);
+	void ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const ContextObjectEntry& entry);
+
+	// Primary function to read any object type, consumes exactly one encoded value
+	ReadResult ReadImpl(const rttr::Type& type, void* value);
+
+	// Reads value written with schema node, by position if reader type has the same schema, or field by field otherwise
+	// Values of matching types are passed detail::binary::SchemaTable::k_noNode
+	ReadResult ReadWithSchema(const uint64_t schemaNodeIdx, const rttr::Type& type, void* value);
+	// Root and context objects, root schema hash is in the header, so matching root is read without parsing schema table
+	ReadResult ReadTopLevel(const uint64_t schemaNodeIdx, const rttr::Type& type, void* value);
+	ReadResult ReadMismatched(const uint64_t schemaNodeIdx, const rttr::Type& type, void* value);
+	ReadResult ReadObjectFields(const detail::binary::SchemaTable::Node& node, const rttr::Type& type, void* value);
+	ReadResult ReadBlittableObjectFields(const detail::binary::SchemaTable::Node& node, const rttr::Type& type, void* value);
+	ReadResult ReadArrayItems(const detail::binary::SchemaTable::Node& node, const rttr::Type& type, void* value);
+	// Skips value written with schema node, returns false if value can't be skipped
+	bool SkipValue(const uint64_t schemaNodeIdx, const std::size_t depth);
+	const detail::binary::SchemaTable::Node* GetSchemaNode(const uint64_t schemaNodeIdx);
+
+	ReadResult ReadObject(const rttr::Type& type, void* value);
+	ReadResult ReadProperty(const rttr::Type& type, rttr::Property* property, void* value, const uint64_t schemaNodeIdx);
+	ReadResult ReadCollection(const rttr::Type& type, void* value, const uint64_t itemSchemaNodeIdx);
+	ReadResult ReadPointer(const rttr::Type& type, void* value);
+	ReadResult ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value);
+	ReadResult ReadAdapter(rs::SerializationAdapter* adapter, void* value);
+	ReadResult ReadArray(const rttr::Type& type, void* value);
+	ReadResult ReadIntegral(const rttr::Type& type, void* value);
+	// Copies count raw values, and fixes their byte order if needed
+	ReadResult ReadRaw(const rttr::Type& type, void* value, const std::size_t count);
+	ReadResult ReadStdString(void* value);
+	ReadResult ReadCString(void* value);
+
+	bool ReadVarUInt(uint64_t& value);
+	bool ReadBytes(std::string_view& bytes, const std::size_t size);
+	// Stops reading, returns failed result for convenience
+	ReadResult Fail(const char* message);
+
+private:
+	std::unique_ptr<InputSource> m_source;
+	const char* m_cursor = nullptr;
+	const char* m_end = nullptr;
+	// Start of root value or objects list, right after the objects count
+	const char* m_body = nullptr;
+	bool m_swapByteOrder = false;
+	bool m_hasError = false;
+	uint64_t m_objectsCount = 0U;
+	uint64_t m_masterObjectId = 0U;
+	// Object read by ReadById, zero for the master object
+	uint64_t m_requestedObjectId = 0U;
+	// Objects index records, if archive has objects index, objects list ends where index starts
+	const char* m_objectsIndex = nullptr;
+	uint64_t m_objectsIndexSize = 0U;
+	uint64_t m_rootSchemaHash = 0U;
+	bool m_rootSchemaMatches = false;
+	std::string_view m_schemaData;
+	// Schema table is parsed on first mismatch only
+	detail::binary::SchemaTable m_schemaTable;
+	bool m_schemaTableRequested = false;
+	detail::binary::SchemaHasher m_schemaHasher;
+	std::unordered_map<uint64_t, ContextObjectEntry> m_contextObjectsIndex;
+	// Storage for strings, read as const char*, they must outlive the reader
+	std::deque<std::string> m_cStringsStorage;
+	bool m_isOk = false;
+};
+
+} // namespace rs
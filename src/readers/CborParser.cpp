@@ -0,0 +1,710 @@
+#include "readers/CborParser.hpp"
+#include "rs/CborFormat.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+
+namespace cbor = rs::detail::cbor;
+
+constexpr uint64_t k_indefiniteItemsCount = std::numeric_limits<uint64_t>::max();
+
+// Real to integer conversion, values out of integer range are zeroed instead of being undefined
+template <typename IntT>
+IntT TruncateReal(const double value)
+{
+	constexpr double k_limit = 9223372036854775808.0; // 2^63
+	if (!(value > -k_limit && value < k_limit))
+		return IntT(0);
+
+	return static_cast<IntT>(static_cast<int64_t>(value));
+}
+
+double BitsToReal(const uint64_t bits, const bool isFloat)
+{
+	if (isFloat)
+	{
+		const uint32_t floatBits = static_cast<uint32_t>(bits);
+		float value;
+		std::memcpy(&value, &floatBits, sizeof(value));
+		return value;
+	}
+
+	double value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+// Half precision float decoding, as given in RFC 8949 appendix D
+double HalfToReal(const uint64_t bits)
+{
+	const int exponent = static_cast<int>((bits >> 10) & 0x1FU);
+	const int mantissa = static_cast<int>(bits & 0x3FFU);
+
+	double value;
+	if (exponent == 0)
+	{
+		value = std::ldexp(mantissa, -24);
+	}
+	else if (exponent != 31)
+	{
+		value = std::ldexp(mantissa + 1024, exponent - 25);
+	}
+	else
+	{
+		value = (mantissa == 0) ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+	}
+
+	return (bits & 0x8000U) ? -value : value;
+}
+
+// Decodes initial byte and argument at cursor, argument of indefinite length items is zero
+bool DecodeHead(const char*& cursor, const char* end, uint8_t& majorType, uint8_t& info, uint64_t& argument)
+{
+	if (cursor >= end)
+		return false;
+
+	const uint8_t initialByte = static_cast<uint8_t>(*cursor);
+	majorType = initialByte >> 5;
+	info = initialByte & 0x1FU;
+
+	if (info <= cbor::k_infoMaxImmediate)
+	{
+		argument = info;
+		++cursor;
+		return true;
+	}
+
+	if (info == cbor::k_infoIndefinite)
+	{
+		argument = 0U;
+		++cursor;
+		return true;
+	}
+
+	// Infos 28 to 30 are reserved
+	if (info > cbor::k_info64)
+		return false;
+
+	const std::size_t size = std::size_t(1U) << (info - cbor::k_info8);
+	if (static_cast<std::size_t>(end - cursor) <= size)
+		return false;
+
+	argument = 0U;
+	for (std::size_t i = 1U; i <= size; ++i)
+	{
+		argument = (argument << 8) | static_cast<uint8_t>(cursor[i]);
+	}
+
+	cursor += size + 1U;
+	return true;
+}
+
+bool IsTypedArrayTag(const uint64_t tag)
+{
+	return tag >= cbor::k_typedArrayFirstTag && tag <= cbor::k_typedArrayLastTag;
+}
+
+// Item kind of typed array tag, see RFC 8746 section 2.1
+rttr::NumericKind GetTypedArrayKind(const uint64_t tag, std::size_t& itemSize)
+{
+	const unsigned sizeExponent = static_cast<unsigned>(tag & 0x03U);
+
+	if (tag & cbor::k_typedArrayFloatFlag)
+	{
+		// Half, single, double and quad precision floats
+		itemSize = std::size_t(2U) << sizeExponent;
+
+		switch (sizeExponent)
+		{
+		case 1U:
+			return rttr::NumericKind::Float;
+		case 2U:
+			return rttr::NumericKind::Double;
+		default:
+			return rttr::NumericKind::None;
+		}
+	}
+
+	itemSize = std::size_t(1U) << sizeExponent;
+	const bool isSigned = (tag & cbor::k_typedArraySignedFlag) != 0U;
+
+	switch (sizeExponent)
+	{
+	case 0U:
+		// Little endian flag of signed bytes array is reserved
+		if (isSigned)
+			return (tag & cbor::k_typedArrayLittleEndianFlag) ? rttr::NumericKind::None : rttr::NumericKind::Int8;
+		return rttr::NumericKind::UInt8;
+	case 1U:
+		return isSigned ? rttr::NumericKind::Int16 : rttr::NumericKind::UInt16;
+	case 2U:
+		return isSigned ? rttr::NumericKind::Int32 : rttr::NumericKind::UInt32;
+	default:
+		return isSigned ? rttr::NumericKind::Int64 : rttr::NumericKind::UInt64;
+	}
+}
+
+}
+
+namespace rs
+{
+namespace detail
+{
+
+CborParser::CborParser(const char* begin, const char* end)
+	: m_begin(begin)
+	, m_cursor(begin)
+	, m_end(end)
+{}
+
+const char* CborParser::SkipIgnoredTags(const char* position) const
+{
+	while (position < m_end)
+	{
+		const char* valueStart = position;
+
+		uint8_t majorType = 0U;
+		uint8_t info = 0U;
+		uint64_t tag = 0U;
+
+		if (static_cast<uint8_t>(*position) >> 5 != cbor::k_majorTag)
+			return position;
+
+		if (!DecodeHead(position, m_end, majorType, info, tag) || info == cbor::k_infoIndefinite)
+			return nullptr;
+
+		if (IsTypedArrayTag(tag))
+			return valueStart;
+	}
+
+	return nullptr;
+}
+
+CborType CborParser::Peek() const
+{
+	if (m_hasError)
+		return CborType::Invalid;
+
+	const char* position = SkipIgnoredTags(m_cursor);
+	if (nullptr == position)
+		return CborType::Invalid;
+
+	const uint8_t initialByte = static_cast<uint8_t>(*position);
+
+	switch (initialByte >> 5)
+	{
+	case cbor::k_majorUnsigned:
+	case cbor::k_majorNegative:
+		return CborType::Integer;
+	case cbor::k_majorBytes:
+		return CborType::ByteString;
+	case cbor::k_majorText:
+		return CborType::TextString;
+	case cbor::k_majorArray:
+		return CborType::Array;
+	case cbor::k_majorMap:
+		return CborType::Map;
+	case cbor::k_majorTag:
+		return CborType::TypedArray;
+	default:
+		break;
+	}
+
+	switch (initialByte)
+	{
+	case cbor::k_null:
+	case cbor::k_undefined:
+		return CborType::Null;
+	case cbor::k_false:
+	case cbor::k_true:
+		return CborType::Boolean;
+	case cbor::k_float16:
+	case cbor::k_float32:
+	case cbor::k_float64:
+		return CborType::Real;
+	case cbor::k_break:
+		// Break is only valid as indefinite container end, which is consumed by NextItem
+		return CborType::Invalid;
+	default:
+		break;
+	}
+
+	// Simple values, second byte of two byte encoding must be 32 at least, per RFC 8949 section 3.3
+	const uint8_t info = initialByte & 0x1FU;
+	if (info < cbor::k_info8)
+		return CborType::Simple;
+	if (info == cbor::k_info8 && position + 1 < m_end && static_cast<uint8_t>(position[1]) >= 32U)
+		return CborType::Simple;
+
+	return CborType::Invalid;
+}
+
+bool CborParser::ReadHead(uint8_t& majorType, uint8_t& info, uint64_t& argument)
+{
+	if (!DecodeHead(m_cursor, m_end, majorType, info, argument))
+		return Fail();
+
+	return true;
+}
+
+bool CborParser::ReadNull()
+{
+	if (Peek() != CborType::Null)
+		return false;
+
+	m_cursor = SkipIgnoredTags(m_cursor) + 1;
+	return true;
+}
+
+bool CborParser::ReadBool(bool& value)
+{
+	if (Peek() != CborType::Boolean)
+		return false;
+
+	m_cursor = SkipIgnoredTags(m_cursor);
+	value = (static_cast<uint8_t>(*m_cursor++) == cbor::k_true);
+	return true;
+}
+
+bool CborParser::ReadNumber(NumberClass& numberClass, uint64_t& bits)
+{
+	const CborType type = Peek();
+	if (type != CborType::Integer && type != CborType::Real)
+		return false;
+
+	m_cursor = SkipIgnoredTags(m_cursor);
+
+	uint8_t majorType = 0U;
+	uint8_t info = 0U;
+	if (!ReadHead(majorType, info, bits))
+		return false;
+
+	if (info == cbor::k_infoIndefinite)
+		return Fail();
+
+	switch (majorType)
+	{
+	case cbor::k_majorUnsigned:
+		numberClass = NumberClass::Unsigned;
+		break;
+	case cbor::k_majorNegative:
+		// Negative integers store -1 - value, which is bitwise complement in two's complement form
+		numberClass = NumberClass::Signed;
+		bits = ~bits;
+		break;
+	default:
+	{
+		switch (info)
+		{
+		case cbor::k_info16:
+		{
+			// Half floats are widened to double, so readers handle only two real widths
+			const double value = HalfToReal(bits);
+			std::memcpy(&bits, &value, sizeof(bits));
+			numberClass = NumberClass::Double;
+		}
+		break;
+		case cbor::k_info32:
+			numberClass = NumberClass::Float;
+			break;
+		default:
+			numberClass = NumberClass::Double;
+			break;
+		}
+	}
+	break;
+	}
+
+	return true;
+}
+
+bool CborParser::ReadSigned(int64_t& value)
+{
+	NumberClass numberClass;
+	uint64_t bits = 0U;
+
+	if (!ReadNumber(numberClass, bits))
+		return false;
+
+	switch (numberClass)
+	{
+	case NumberClass::Float:
+	case NumberClass::Double:
+		value = TruncateReal<int64_t>(BitsToReal(bits, numberClass == NumberClass::Float));
+		break;
+	default:
+		value = static_cast<int64_t>(bits);
+		break;
+	}
+
+	return true;
+}
+
+bool CborParser::ReadUnsigned(uint64_t& value)
+{
+	NumberClass numberClass;
+	uint64_t bits = 0U;
+
+	if (!ReadNumber(numberClass, bits))
+		return false;
+
+	switch (numberClass)
+	{
+	case NumberClass::Float:
+	case NumberClass::Double:
+		value = TruncateReal<uint64_t>(BitsToReal(bits, numberClass == NumberClass::Float));
+		break;
+	default:
+		value = bits;
+		break;
+	}
+
+	return true;
+}
+
+bool CborParser::ReadReal(double& value)
+{
+	NumberClass numberClass;
+	uint64_t bits = 0U;
+
+	if (!ReadNumber(numberClass, bits))
+		return false;
+
+	switch (numberClass)
+	{
+	case NumberClass::Unsigned:
+		value = static_cast<double>(bits);
+		break;
+	case NumberClass::Signed:
+		value = static_cast<double>(static_cast<int64_t>(bits));
+		break;
+	default:
+		value = BitsToReal(bits, numberClass == NumberClass::Float);
+		break;
+	}
+
+	return true;
+}
+
+bool CborParser::ReadString(const uint8_t majorType, std::string_view& value)
+{
+	m_cursor = SkipIgnoredTags(m_cursor);
+
+	uint8_t headMajorType = 0U;
+	uint8_t info = 0U;
+	uint64_t length = 0U;
+
+	if (!ReadHead(headMajorType, info, length))
+		return false;
+
+	if (info != cbor::k_infoIndefinite)
+	{
+		if (static_cast<uint64_t>(m_end - m_cursor) < length)
+			return Fail();
+
+		value = std::string_view(m_cursor, static_cast<std::size_t>(length));
+		m_cursor += length;
+		return true;
+	}
+
+	// Indefinite length string is a sequence of definite length chunks of the same major type, ended by break
+	m_scratch.clear();
+
+	for (;;)
+	{
+		if (m_cursor >= m_end)
+			return Fail();
+
+		if (static_cast<uint8_t>(*m_cursor) == cbor::k_break)
+		{
+			++m_cursor;
+			break;
+		}
+
+		if (!ReadHead(headMajorType, info, length))
+			return false;
+
+		if (headMajorType != majorType || info == cbor::k_infoIndefinite || static_cast<uint64_t>(m_end - m_cursor) < length)
+			return Fail();
+
+		m_scratch.append(m_cursor, static_cast<std::size_t>(length));
+		m_cursor += length;
+	}
+
+	value = m_scratch;
+	return true;
+}
+
+bool CborParser::ReadText(std::string_view& value)
+{
+	if (Peek() != CborType::TextString)
+		return false;
+
+	return ReadString(cbor::k_majorText, value);
+}
+
+bool CborParser::ReadBytes(std::string_view& value)
+{
+	if (Peek() != CborType::ByteString)
+		return false;
+
+	return ReadString(cbor::k_majorBytes, value);
+}
+
+bool CborParser::ReadTypedArray(CborTypedArray& value)
+{
+	if (Peek() != CborType::TypedArray)
+		return false;
+
+	m_cursor = SkipIgnoredTags(m_cursor);
+
+	uint8_t majorType = 0U;
+	uint8_t info = 0U;
+	uint64_t tag = 0U;
+
+	if (!ReadHead(majorType, info, tag))
+		return false;
+
+	// Typed array tag content must be a byte string, holding whole number of items
+	std::string_view bytes;
+	if (!ReadBytes(bytes))
+		return Fail();
+
+	value.kind = GetTypedArrayKind(tag, value.itemSize);
+	value.byteOrder = (tag & cbor::k_typedArrayLittleEndianFlag) ? ByteOrder::LittleEndian : ByteOrder::BigEndian;
+
+	if (bytes.size() % value.itemSize != 0U)
+		return Fail();
+
+	value.itemsCount = bytes.size() / value.itemSize;
+	value.items = bytes.data();
+	return true;
+}
+
+bool CborParser::BeginContainer(const std::size_t minItemSize, CborContainer& container)
+{
+	m_cursor = SkipIgnoredTags(m_cursor);
+
+	uint8_t headMajorType = 0U;
+	uint8_t info = 0U;
+	uint64_t count = 0U;
+
+	if (!ReadHead(headMajorType, info, count))
+		return false;
+
+	container.isIndefinite = (info == cbor::k_infoIndefinite);
+	container.itemsLeft = 0U;
+
+	if (!container.isIndefinite)
+	{
+		// Every item takes one byte at least, so larger counts can only come from corrupted data
+		if (count > static_cast<uint64_t>(m_end - m_cursor) / minItemSize)
+			return Fail();
+
+		container.itemsLeft = static_cast<std::size_t>(count);
+	}
+
+	return true;
+}
+
+bool CborParser::BeginArray(CborContainer& container)
+{
+	if (Peek() != CborType::Array)
+		return false;
+
+	return BeginContainer(1U, container);
+}
+
+bool CborParser::BeginMap(CborContainer& container)
+{
+	if (Peek() != CborType::Map)
+		return false;
+
+	// Every member is a key and a value
+	return BeginContainer(2U, container);
+}
+
+bool CborParser::NextItem(CborContainer& container)
+{
+	if (m_hasError)
+		return false;
+
+	if (!container.isIndefinite)
+	{
+		if (container.itemsLeft == 0U)
+			return false;
+
+		--container.itemsLeft;
+		return true;
+	}
+
+	if (m_cursor >= m_end)
+		return Fail();
+
+	if (static_cast<uint8_t>(*m_cursor) == cbor::k_break)
+	{
+		++m_cursor;
+		container.isIndefinite = false;
+		return false;
+	}
+
+	return true;
+}
+
+bool CborParser::SkipValue()
+{
+	// Values left to skip in every open container, so nesting depth costs no recursion
+	m_skipStack.clear();
+
+	do
+	{
+		if (!m_skipStack.empty())
+		{
+			uint64_t& itemsLeft = m_skipStack.back();
+
+			if (itemsLeft == k_indefiniteItemsCount)
+			{
+				if (m_cursor >= m_end)
+					return Fail();
+
+				if (static_cast<uint8_t>(*m_cursor) == cbor::k_break)
+				{
+					++m_cursor;
+					m_skipStack.pop_back();
+					continue;
+				}
+			}
+			else if (itemsLeft == 0U)
+			{
+				m_skipStack.pop_back();
+				continue;
+			}
+			else
+			{
+				--itemsLeft;
+			}
+		}
+
+		CborContainer container;
+		CborTypedArray typedArray;
+		std::string_view payload;
+		NumberClass numberClass;
+		uint64_t bits = 0U;
+
+		switch (Peek())
+		{
+		case CborType::Null:
+		case CborType::Boolean:
+			m_cursor = SkipIgnoredTags(m_cursor) + 1;
+			break;
+		case CborType::Simple:
+			m_cursor = SkipIgnoredTags(m_cursor);
+			m_cursor += ((static_cast<uint8_t>(*m_cursor) & 0x1FU) == cbor::k_info8) ? 2 : 1;
+			break;
+		case CborType::Integer:
+		case CborType::Real:
+			if (!ReadNumber(numberClass, bits))
+				return Fail();
+			break;
+		case CborType::TextString:
+			if (!ReadText(payload))
+				return Fail();
+			break;
+		case CborType::ByteString:
+			if (!ReadBytes(payload))
+				return Fail();
+			break;
+		case CborType::TypedArray:
+			if (!ReadTypedArray(typedArray))
+				return Fail();
+			break;
+		case CborType::Array:
+			if (!BeginArray(container))
+				return Fail();
+			m_skipStack.push_back(container.isIndefinite ? k_indefiniteItemsCount : container.itemsLeft);
+			break;
+		case CborType::Map:
+			if (!BeginMap(container))
+				return Fail();
+			m_skipStack.push_back(container.isIndefinite ? k_indefiniteItemsCount : 2U * static_cast<uint64_t>(container.itemsLeft));
+			break;
+		default:
+			return Fail();
+		}
+	}
+	while (!m_skipStack.empty());
+
+	return true;
+}
+
+const char* CborParser::FindMemberValue(const char* mapStart, std::string_view key)
+{
+	const char* savedCursor = m_cursor;
+	const char* memberValue = nullptr;
+
+	m_cursor = mapStart;
+
+	CborContainer container;
+	if (BeginMap(container))
+	{
+		while (NextItem(container))
+		{
+			std::string_view memberKey;
+			if (ReadText(memberKey))
+			{
+				if (memberKey == key)
+				{
+					memberValue = m_cursor;
+					break;
+				}
+			}
+			else
+			{
+				SkipValue();
+			}
+
+			SkipValue();
+		}
+	}
+
+	m_cursor = savedCursor;
+	return memberValue;
+}
+
+const char* CborParser::GetCursor() const
+{
+	return m_cursor;
+}
+
+void CborParser::SetCursor(const char* cursor)
+{
+	m_cursor = cursor;
+}
+
+bool CborParser::IsAtEnd() const
+{
+	return m_cursor >= m_end;
+}
+
+bool CborParser::HasError() const
+{
+	return m_hasError;
+}
+
+std::size_t CborParser::GetErrorOffset() const
+{
+	return static_cast<std::size_t>(m_cursor - m_begin);
+}
+
+bool CborParser::Fail()
+{
+	m_hasError = true;
+	return false;
+}
+
+} // namespace detail
+} // namespace rs
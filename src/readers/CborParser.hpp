@@ -0,0 +1,131 @@
+#pragma once
+#include "rs/ByteOrder.hpp"
+#include "rttr/details/ScalarParams.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace rs
+{
+namespace detail
+{
+
+enum class CborType
+{
+	Invalid,
+	Null,
+	Boolean,
+	Integer,
+	Real,
+	ByteString,
+	TextString,
+	Array,
+	Map,
+	TypedArray,
+	// Simple values with no meaning for the reader, they can only be skipped
+	Simple,
+};
+
+// Position inside array or map, definite containers count items down, indefinite ones end with break byte
+struct CborContainer
+{
+	std::size_t itemsLeft = 0U;
+	bool isIndefinite = false;
+};
+
+// RFC 8746 typed array, items point to source buffer or to parser scratch storage, and may be unaligned
+struct CborTypedArray
+{
+	// NumericKind::None for item types which have no C++ counterpart (half and quad floats)
+	rttr::NumericKind kind = rttr::NumericKind::None;
+	ByteOrder byteOrder = ByteOrder::BigEndian;
+	std::size_t itemSize = 0U;
+	std::size_t itemsCount = 0U;
+	const char* items = nullptr;
+};
+
+/*
+* @brief Pull parser over contiguous CBOR data
+*
+* Same idea as MsgPackParser: values are decoded on demand, strings are views into the source buffer.
+* Semantic tags other than typed array ones are skipped transparently, so tagged values read as plain ones.
+* Both definite and indefinite length items are accepted, indefinite strings are joined into scratch storage.
+*/
+class CborParser
+{
+public:
+	CborParser() = default;
+	CborParser(const char* begin, const char* end);
+
+	// Returns the type of next value without consuming it
+	CborType Peek() const;
+
+	// Reads null or undefined value
+	bool ReadNull();
+	bool ReadBool(bool& value);
+	// Integers are converted the same way json readers do: out of range values wrap, reals are truncated
+	bool ReadSigned(int64_t& value);
+	bool ReadUnsigned(uint64_t& value);
+	// Reads real or integer value
+	bool ReadReal(double& value);
+	// Strings point to the source buffer, or to scratch storage for indefinite length ones
+	// Scratch storage is reused by next string read, so value must be copied before reading further
+	bool ReadText(std::string_view& value);
+	bool ReadBytes(std::string_view& value);
+	bool ReadTypedArray(CborTypedArray& value);
+
+	// Container traversal: Begin consumes container header, then NextItem is called until it returns false
+	// After NextItem returned true, caller must consume one value, or key and value for maps
+	bool BeginArray(CborContainer& container);
+	bool BeginMap(CborContainer& container);
+	bool NextItem(CborContainer& container);
+
+	// Skips the next value of any kind, nested containers are skipped without recursion
+	bool SkipValue();
+
+	// Looks for the text key in the map starting at mapStart, doesn't move the cursor
+	// Returns member value position, or nullptr if map has no such key
+	const char* FindMemberValue(const char* mapStart, std::string_view key);
+
+	const char* GetCursor() const;
+	// Cursor can only be restored to the position of some value start
+	void SetCursor(const char* cursor);
+
+	bool IsAtEnd() const;
+	bool HasError() const;
+	std::size_t GetErrorOffset() const;
+
+private:
+	enum class NumberClass
+	{
+		Unsigned,
+		Signed,
+		Float,
+		Double,
+	};
+
+	// Returns position of the value, past the ignored tags, or nullptr if data is truncated
+	const char* SkipIgnoredTags(const char* position) const;
+	// Consumes initial byte and argument of the next data item
+	bool ReadHead(uint8_t& majorType, uint8_t& info, uint64_t& argument);
+	// Consumes any integer or real value, bits are sign extended integer, or raw bits of float or double
+	bool ReadNumber(NumberClass& numberClass, uint64_t& bits);
+	bool ReadString(const uint8_t majorType, std::string_view& value);
+	bool BeginContainer(const std::size_t minItemSize, CborContainer& container);
+	bool Fail();
+
+private:
+	const char* m_begin = nullptr;
+	const char* m_cursor = nullptr;
+	const char* m_end = nullptr;
+	std::string m_scratch;
+	// Items left in containers being skipped, reused between SkipValue calls
+	std::vector<uint64_t> m_skipStack;
+	bool m_hasError = false;
+};
+
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,1082 @@
+#include "readers/CborReader.hpp"
+#include "rttr/Property.hpp"
+#include "rttr/Manager.hpp"
+#include "rs/SerializationKeywords.hpp"
+#include "rs/ByteOrder.hpp"
+#include "actions/CallObjectMutatorAction.hpp"
+#include "actions/ResolvePointerAction.hpp"
+#include "actions/CollectionInsertAction.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+// Reads single number into value of exact type, with the same conversions json readers do
+template <typename T>
+bool ReadNumber(rs::detail::CborParser& parser, T& value)
+{
+	if constexpr (std::is_same_v<T, bool>)
+	{
+		switch (parser.Peek())
+		{
+		case rs::detail::CborType::Boolean:
+			return parser.ReadBool(value);
+		case rs::detail::CborType::Null:
+			value = false;
+			return parser.ReadNull();
+		default:
+		{
+			uint64_t intValue = 0U;
+			if (!parser.ReadUnsigned(intValue))
+				return false;
+
+			value = !!intValue;
+			return true;
+		}
+		}
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		double realValue = 0.0;
+		if (!parser.ReadReal(realValue))
+			return false;
+
+		value = static_cast<T>(realValue);
+		return true;
+	}
+	else if constexpr (std::is_signed_v<T>)
+	{
+		int64_t intValue = 0;
+		if (!parser.ReadSigned(intValue))
+			return false;
+
+		value = static_cast<T>(intValue);
+		return true;
+	}
+	else
+	{
+		uint64_t intValue = 0U;
+		if (!parser.ReadUnsigned(intValue))
+			return false;
+
+		value = static_cast<T>(intValue);
+		return true;
+	}
+}
+
+// Real to integer conversion zeroes values out of integer range, as parser does for single values
+template <typename TargetT, typename SourceT>
+TargetT ConvertNumber(const SourceT value)
+{
+	if constexpr (std::is_same_v<TargetT, bool>)
+	{
+		return value != SourceT(0);
+	}
+	else if constexpr (std::is_floating_point_v<SourceT> && std::is_integral_v<TargetT>)
+	{
+		constexpr double k_limit = 9223372036854775808.0; // 2^63
+		const double realValue = static_cast<double>(value);
+		if (!(realValue > -k_limit && realValue < k_limit))
+			return TargetT(0);
+
+		return static_cast<TargetT>(static_cast<int64_t>(realValue));
+	}
+	else
+	{
+		return static_cast<TargetT>(value);
+	}
+}
+
+// Copies count typed array items into items of target numeric kind, byte order and item type are converted if they differ
+bool ConvertTypedArrayItems(const rs::detail::CborTypedArray& typedArray, const rttr::NumericKind targetKind, void* targetItems, const std::size_t count)
+{
+	if (count == 0U)
+		return true;
+
+	const bool swapByteOrder = (typedArray.byteOrder != rs::k_hostByteOrder);
+
+	return rttr::VisitNumericKind(typedArray.kind, [&](auto sourceTag)
+	{
+		using SourceT = typename decltype(sourceTag)::type;
+
+		return rttr::VisitNumericKind(targetKind, [&](auto targetTag)
+		{
+			using TargetT = typename decltype(targetTag)::type;
+
+			TargetT* typedTargetItems = static_cast<TargetT*>(targetItems);
+
+			if constexpr (std::is_same_v<SourceT, TargetT>)
+			{
+				std::memcpy(typedTargetItems, typedArray.items, count * sizeof(TargetT));
+
+				if (swapByteOrder && sizeof(TargetT) > 1U)
+				{
+					for (std::size_t i = 0U; i < count; ++i)
+					{
+						rs::ByteSwapInPlace(typedTargetItems + i, sizeof(TargetT));
+					}
+				}
+			}
+			else
+			{
+				for (std::size_t i = 0U; i < count; ++i)
+				{
+					SourceT item;
+					std::memcpy(&item, typedArray.items + i * sizeof(SourceT), sizeof(SourceT));
+
+					if (swapByteOrder)
+					{
+						rs::ByteSwapInPlace(&item, sizeof(SourceT));
+					}
+
+					typedTargetItems[i] = ConvertNumber<TargetT>(item);
+				}
+			}
+
+			return true;
+		});
+	});
+}
+
+}
+
+namespace rs
+{
+
+CborReader::CborReader(std::istream& stream)
+{
+	std::size_t startOffset = stream.tellg();
+
+	stream.seekg(0, std::ios::end);
+	std::size_t bufferSize = static_cast<std::size_t>(stream.tellg()) - startOffset;
+	stream.seekg(startOffset, std::ios::beg);
+
+	if (bufferSize > 0U)
+	{
+		std::string buffer(bufferSize, '\0');
+		stream.read(&buffer[0], bufferSize);
+		buffer.resize(static_cast<std::size_t>(stream.gcount()));
+
+		m_source = std::make_unique<MemoryInputSource>(std::move(buffer));
+		InitParser();
+	}
+
+	if (!m_isOk)
+	{
+		// Revert stream back to original offset
+		stream.clear();
+		stream.seekg(startOffset, std::ios::beg);
+	}
+}
+
+CborReader::CborReader(std::string content)
+	: m_source(std::make_unique<MemoryInputSource>(std::move(content)))
+{
+	InitParser();
+}
+
+CborReader::CborReader(std::unique_ptr<InputSource>&& source)
+	: m_source(std::move(source))
+{
+	InitParser();
+}
+
+void CborReader::InitParser()
+{
+	if (m_source && m_source->IsOk())
+	{
+		m_parser = detail::CborParser(m_source->GetData(), m_source->GetData() + m_source->GetSize());
+		m_isOk = (m_parser.Peek() != detail::CborType::Invalid);
+	}
+}
+
+bool CborReader::IndexContextObjects(uint64_t& masterObjectId)
+{
+	const char* rootPosition = m_parser.GetCursor();
+	const char* contextObjectsPosition = nullptr;
+	bool hasMasterObjectId = false;
+
+	detail::CborContainer rootMap;
+	if (m_parser.BeginMap(rootMap))
+	{
+		// Objects list documents have only master object id and objects list members, so stop at the first other member
+		while (m_parser.NextItem(rootMap))
+		{
+			std::string_view key;
+			if (!m_parser.ReadText(key))
+				break;
+
+			if (key == K_MASTER_OBJ_ID && m_parser.Peek() == detail::CborType::Integer)
+			{
+				hasMasterObjectId = m_parser.ReadUnsigned(masterObjectId);
+			}
+			else if (key == K_CONTEXT_OBJECTS && m_parser.Peek() == detail::CborType::Array)
+			{
+				contextObjectsPosition = m_parser.GetCursor();
+				m_parser.SkipValue();
+			}
+			else if (hasMasterObjectId || nullptr != contextObjectsPosition)
+			{
+				m_parser.SkipValue();
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+
+	const bool hasObjectsList = hasMasterObjectId && nullptr != contextObjectsPosition && !m_parser.HasError();
+	if (hasObjectsList)
+	{
+		// Index objects list, only ids are parsed here, object values are skipped
+		m_parser.SetCursor(contextObjectsPosition);
+
+		detail::CborContainer objectsList;
+		m_parser.BeginArray(objectsList);
+
+		while (m_parser.NextItem(objectsList))
+		{
+			detail::CborContainer objectMap;
+			if (!m_parser.BeginMap(objectMap))
+			{
+				m_parser.SkipValue();
+				continue;
+			}
+
+			uint64_t objectId = 0U;
+			bool hasId = false;
+			const char* objectValuePosition = nullptr;
+
+			while (m_parser.NextItem(objectMap))
+			{
+				std::string_view key;
+				if (!m_parser.ReadText(key))
+				{
+					m_parser.SkipValue();
+				}
+				else if (key == K_CONTEXT_OBJ_ID && m_parser.Peek() == detail::CborType::Integer)
+				{
+					hasId = m_parser.ReadUnsigned(objectId);
+					continue;
+				}
+				else if (key == K_CONTEXT_OBJ_VAL)
+				{
+					objectValuePosition = m_parser.GetCursor();
+				}
+
+				m_parser.SkipValue();
+			}
+
+			if (hasId && nullptr != objectValuePosition)
+			{
+				m_contextObjectsIndex.emplace(objectId, objectValuePosition);
+			}
+		}
+	}
+
+	m_parser.SetCursor(rootPosition);
+
+	return hasObjectsList && !m_parser.HasError();
+}
+
+void CborReader::ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const char* objectValuePosition)
+{
+	m_parser.SetCursor(objectValuePosition);
+	ReadResult objectReadResult = ReadImpl(type, value);
+
+	if (objectReadResult.success)
+	{
+		m_context->AddObject(objectId, type, value);
+	}
+	else
+	{
+		RS_LOG_ERROR("Failed to read context object!");
+	}
+}
+
+void CborReader::DoRead(const rttr::Type& type, void* value)
+{
+	uint64_t masterObjectId = 0U;
+	m_hasObjectsList = IndexContextObjects(masterObjectId);
+
+	if (m_hasObjectsList)
+	{
+		auto masterObjectIt = m_contextObjectsIndex.find(masterObjectId);
+		if (masterObjectIt != m_contextObjectsIndex.end())
+		{
+			// Parse master object, it's marked as visited first, so references to it are not queued
+			MarkContextObjectVisited(masterObjectId);
+			ReadContextObject(type, value, masterObjectId, masterObjectIt->second);
+
+			// Handle referenced context objects, each of them is queued only once, so every object is loaded exactly one time
+			std::pair<uint64_t, rttr::Type> objectReference;
+			while (PopPendingContextObject(objectReference))
+			{
+				bool contextObjectValid = false;
+
+				auto contextObjectIt = m_contextObjectsIndex.find(objectReference.first);
+				if (contextObjectIt != m_contextObjectsIndex.end())
+				{
+					rttr::Type pointedType = objectReference.second;
+
+					if (pointedType.IsValid())
+					{
+						// Check actual type of polymorphic type
+						if (pointedType.IsPolymorphic())
+						{
+							const char* typeIdPosition = m_parser.FindMemberValue(contextObjectIt->second, K_TYPE_ID);
+							if (nullptr != typeIdPosition)
+							{
+								std::string_view typeName;
+								m_parser.SetCursor(typeIdPosition);
+
+								if (m_parser.ReadText(typeName))
+								{
+									rttr::Type deducedType = rttr::Reflect(std::string(typeName).c_str());
+									if (deducedType.IsValid() && deducedType.IsBaseClass(pointedType))
+									{
+										pointedType = deducedType;
+									}
+								}
+							}
+						}
+
+						void* pointedValue = pointedType.Instantiate();
+						if (nullptr != pointedValue)
+						{
+							ReadContextObject(pointedType, pointedValue, objectReference.first, contextObjectIt->second);
+							contextObjectValid = true;
+						}
+					}
+				}
+
+				if (!contextObjectValid)
+				{
+					m_context->AddObject(objectReference.first, objectReference.second, nullptr);
+				}
+			}
+		}
+		else
+		{
+			RS_LOG_ERROR("Master object not found in the context objects list!");
+		}
+	}
+	else
+	{
+		// We have single object, simply read it here
+		ReadImpl(type, value);
+	}
+
+	if (m_parser.HasError())
+	{
+		RS_LOG_ERROR("CBOR parse error at offset %llu!", static_cast<unsigned long long>(m_parser.GetErrorOffset()));
+	}
+}
+
+bool CborReader::CheckSourceHasObjectsList()
+{
+	return m_hasObjectsList;
+}
+
+ReadResult CborReader::SkipMismatchedValue()
+{
+	m_parser.SkipValue();
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult CborReader::ReadObjectBases(const rttr::Type& type, void* value)
+{
+	detail::CborContainer bases;
+	if (!m_parser.BeginArray(bases))
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::OKResult();
+	const auto& baseClassesInfo = type.GetBaseClasses();
+
+	while (m_parser.NextItem(bases))
+	{
+		const char* baseValuePosition = m_parser.GetCursor();
+		bool baseClassResolved = false;
+
+		if (m_parser.Peek() == detail::CborType::Map)
+		{
+			// Lookup base class name first, then read the base part from the same map
+			const char* baseIdPosition = m_parser.FindMemberValue(baseValuePosition, K_BASE_ID);
+			if (nullptr != baseIdPosition)
+			{
+				std::string_view baseName;
+				m_parser.SetCursor(baseIdPosition);
+				m_parser.ReadText(baseName);
+
+				for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+				{
+					rttr::Type baseClass = baseClassesInfo.first[i];
+					if (baseName == baseClass.GetName())
+					{
+						m_parser.SetCursor(baseValuePosition);
+						ReadResult baseReadResult = ReadImpl(baseClass, value);
+						result.Merge(baseReadResult);
+
+						baseClassResolved = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (!baseClassResolved)
+		{
+			RS_LOG_ERROR("Base class of '%s' not resolved!", type.GetName());
+
+			m_parser.SetCursor(baseValuePosition);
+			m_parser.SkipValue();
+		}
+	}
+
+	return result;
+}
+
+ReadResult CborReader::ReadObjectProperties(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::OKResult(); // If we have no properties, it's OK
+
+	const bool isCollection = type.IsCollection();
+
+	// Members are resolved using shape of the previous object of this type, so homogeneous objects cost one key comparison per member
+	detail::ObjectShapeCache::Shape& shape = m_shapeCache.GetShape(type);
+
+	detail::CborContainer members;
+	m_parser.BeginMap(members);
+
+	for (std::size_t memberPosition = 0U; m_parser.NextItem(members); ++memberPosition)
+	{
+		std::string_view key;
+		if (!m_parser.ReadText(key))
+		{
+			// Only string keys can match properties
+			m_parser.SkipValue();
+			m_parser.SkipValue();
+			continue;
+		}
+
+		const std::size_t propertyIdx = shape.Resolve(type, memberPosition, key);
+		if (propertyIdx == rttr::k_invalidPropertyIndex)
+		{
+			if (key == K_BASES)
+			{
+				ReadResult basesReadResult = ReadObjectBases(type, value);
+				result.Merge(basesReadResult);
+			}
+			else if (isCollection && key == K_COLLECTION_ITEMS)
+			{
+				ReadResult collectionReadResult = ReadCollection(type, value);
+				result.Merge(collectionReadResult);
+			}
+			else
+			{
+				// If we couldn't find the property for map member, just skip it, and produce no error
+				m_parser.SkipValue();
+			}
+
+			continue;
+		}
+
+		rttr::Property* property = type.GetProperty(propertyIdx);
+		const rttr::Type& propertyType = property->GetType();
+
+		RS_LOG_TRACE("Reading property '%s::%s'", type.GetName(), property->GetName());
+
+		// Decide to create temp variable or not
+		void* propertyValuePtr = nullptr;
+		bool needsTempVar = property->NeedsTempVariable();
+
+		if (needsTempVar)
+		{
+			propertyValuePtr = m_context->CreateTempVariable(propertyType);
+		}
+		else
+		{
+			propertyValuePtr = property->GetValueAddress(value);
+		}
+
+		// Read value
+		ReadResult propertyReadResult = ReadImpl(propertyType, propertyValuePtr);
+
+		if (propertyReadResult.Succeeded())
+		{
+			// We have succeeded, now call property mutator function to apply temp
+			property->CallMutator(value, propertyValuePtr);
+
+			// As we already applied value to target, we can release temp variable
+			if (needsTempVar)
+			{
+				m_context->DestroyTempVariable(propertyValuePtr);
+			}
+		}
+		else
+		{
+			if (!propertyReadResult.allEntitiesResolved)
+			{
+				// If not all property value entities are resolved, make use of deferred commands list
+				auto callMutatorAction = std::make_unique<detail::CallObjectMutatorAction>(0, property, value, propertyValuePtr);
+				m_deferredCommandsList.push_back(std::move(callMutatorAction));
+
+				// Notify calling code that not all entities are resolved for this object
+				result.allEntitiesResolved = false;
+			}
+		}
+	}
+
+	return result;
+}
+
+ReadResult CborReader::ReadCollection(const rttr::Type& type, void* value)
+{
+	if (m_parser.Peek() == detail::CborType::TypedArray)
+		return ReadTypedArrayCollection(type, value);
+
+	if (m_parser.Peek() != detail::CborType::Array)
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::GenericFailResult();
+
+	// We have correct value with items data, now get collection traits from meta type
+	std::unique_ptr<rttr::CollectionInserterBase> inserter = type.CreateCollectionInserter(value);
+	rttr::Type collectionItemType = type.GetCollectionItemType();
+
+	if (!inserter || !collectionItemType.IsValid())
+		return SkipMismatchedValue();
+
+	// If we reach here, we have a valid collection
+	result.success = true;
+
+	const char* arrayStart = m_parser.GetCursor();
+
+	// Items count of definite length array is stored in its header, so no lookahead is needed
+	detail::CborContainer items;
+	if (!m_parser.BeginArray(items))
+		return ReadResult::GenericFailResult();
+
+	const std::size_t itemsCount = items.itemsLeft;
+
+	if (!items.isIndefinite)
+	{
+		// Contiguous collections of numbers are filled at once, skipping per item dispatch
+		if (collectionItemType.IsPlainNumeric() && type.IsContiguousCollection())
+		{
+			void* itemsData = type.AppendCollectionItems(value, itemsCount);
+			if (nullptr != itemsData)
+			{
+				if (ReadNumericItems(collectionItemType.GetNumericKind(), itemsData, itemsCount))
+					return result;
+
+				// Roll back and read items one by one
+				type.RemoveCollectionItems(value, itemsCount);
+				m_parser.SetCursor(arrayStart);
+				m_parser.BeginArray(items);
+			}
+		}
+
+		type.ReserveCollection(value, itemsCount);
+		inserter->SetReservedItemsCount(itemsCount);
+	}
+
+	for (std::size_t i = 0U; m_parser.NextItem(items); ++i)
+	{
+		RS_LOG_TRACE("Reading collection item %llu", static_cast<unsigned long long>(i));
+
+		// Prefer reading straight into collection storage, it saves temp object and a copy per item
+		void* collectionItem = inserter->Emplace();
+		if (nullptr != collectionItem)
+		{
+			ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem);
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Item stays in place, deferred actions will complete it
+				result.allEntitiesResolved = false;
+			}
+			else if (!itemReadResult.success)
+			{
+				RS_LOG_ERROR("Collection item failed to be read!");
+				inserter->CancelEmplace();
+			}
+
+			continue;
+		}
+
+		collectionItem = m_context->CreateTempVariable(collectionItemType);
+		ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem);
+
+		if (itemReadResult.Succeeded())
+		{
+			// Item read successfully, so we can safely insert here and release item temp variable
+			inserter->InsertMove(collectionItem);
+			m_context->DestroyTempVariable(collectionItem);
+		}
+		else
+		{
+			RS_LOG_ERROR("Collection item failed to be read!");
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Notify caller that not all entities are resolved, and we must now defer actions using commands list
+				result.allEntitiesResolved = false;
+
+				// Not all entities of collection item are resolved, put insert command to deferred commands list
+				auto insertAction = std::make_unique<detail::CollectionInsertAction>(0, type.CreateCollectionInserter(value), collectionItem);
+				m_deferredCommandsList.push_back(std::move(insertAction));
+			}
+
+			// For other error cases, we just skip the item and don't add it to final collection
+		}
+	}
+
+	return result;
+}
+
+ReadResult CborReader::ReadTypedArrayCollection(const rttr::Type& type, void* value)
+{
+	detail::CborTypedArray typedArray;
+	if (!m_parser.ReadTypedArray(typedArray))
+		return ReadResult::GenericFailResult();
+
+	const rttr::Type collectionItemType = type.GetCollectionItemType();
+	if (typedArray.kind == rttr::NumericKind::None || !collectionItemType.IsPlainNumeric())
+	{
+		RS_LOG_ERROR("Typed array items can't be read into collection '%s'!", type.GetName());
+		return ReadResult::GenericFailResult();
+	}
+
+	const rttr::NumericKind itemKind = collectionItemType.GetNumericKind();
+
+	// Contiguous collections get all items at once, it's a single copy if item type and byte order match
+	if (type.IsContiguousCollection())
+	{
+		void* items = type.AppendCollectionItems(value, typedArray.itemsCount);
+		if (nullptr != items)
+		{
+			ConvertTypedArrayItems(typedArray, itemKind, items, typedArray.itemsCount);
+			return ReadResult::OKResult();
+		}
+	}
+
+	std::unique_ptr<rttr::CollectionInserterBase> inserter = type.CreateCollectionInserter(value);
+	if (!inserter)
+		return ReadResult::GenericFailResult();
+
+	type.ReserveCollection(value, typedArray.itemsCount);
+	inserter->SetReservedItemsCount(typedArray.itemsCount);
+
+	// Other collections get items one by one
+	detail::CborTypedArray item = typedArray;
+	item.itemsCount = 1U;
+
+	for (std::size_t i = 0U; i < typedArray.itemsCount; ++i, item.items += item.itemSize)
+	{
+		void* collectionItem = inserter->Emplace();
+		if (nullptr != collectionItem)
+		{
+			ConvertTypedArrayItems(item, itemKind, collectionItem, 1U);
+			continue;
+		}
+
+		collectionItem = m_context->CreateTempVariable(collectionItemType);
+		ConvertTypedArrayItems(item, itemKind, collectionItem, 1U);
+
+		inserter->InsertMove(collectionItem);
+		m_context->DestroyTempVariable(collectionItem);
+	}
+
+	return ReadResult::OKResult();
+}
+
+ReadResult CborReader::ReadPointer(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+
+	switch (m_parser.Peek())
+	{
+		case detail::CborType::Null:
+		{
+			// Resolve null pointer
+			m_parser.ReadNull();
+			rttr::AssignPointerValue(value, nullptr);
+			result = ReadResult::OKResult();
+		}
+		break;
+		case detail::CborType::Integer:
+		{
+			uint64_t objectId = 0U;
+			if (!m_parser.ReadUnsigned(objectId))
+				break;
+
+			EnqueueContextObject(objectId, type.GetPointedType());
+
+			result = ReadResult::OKResult();
+
+			// If we have resolved pointer address right now, use it
+			auto referencedObjectData = m_context->GetObjectById(objectId);
+			if (nullptr != referencedObjectData)
+			{
+				rttr::AssignPointerValue(value, referencedObjectData->objectPtr);
+			}
+			else
+			{
+				// Pointer can't be resolved right now, so put resolve action into deferred commands list
+				auto resolvePtrAction = std::make_unique<detail::ResolvePointerAction>(0, m_context.get(), value, objectId);
+				m_deferredCommandsList.push_back(std::move(resolvePtrAction));
+
+				result.allEntitiesResolved = false;
+			}
+		}
+		break;
+		default:
+			result = SkipMismatchedValue();
+			break;
+	}
+
+	return result;
+}
+
+ReadResult CborReader::ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+
+	if (proxyTypeData->readConverter)
+	{
+		// Create proxy object
+		void* proxyObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+
+		// Read proxy object
+		result = ReadImpl(proxyTypeData->proxyType, proxyObject);
+
+		// Create target object using proxy constructor
+		proxyTypeData->readConverter->Convert(value, proxyObject);
+	}
+	else
+	{
+		RS_LOG_ERROR("Type has proxy type, but no read converter defined!");
+		m_parser.SkipValue();
+	}
+
+	return result;
+}
+
+ReadResult CborReader::ReadAdapter(rs::SerializationAdapter* adapter, void* value)
+{
+	const char* valuePosition = m_parser.GetCursor();
+
+	auto readPayload = [&](SerializationAdapter::DataChunk& payload)
+	{
+		if (!payload.type.IsValid() || m_parser.Peek() != detail::CborType::Map)
+			return ReadResult::OKResult();
+
+		// If it's a map with adapter member, treat it as payload
+		const char* payloadPosition = m_parser.FindMemberValue(valuePosition, K_ADAPTER);
+		if (nullptr == payloadPosition)
+			return ReadResult::OKResult();
+
+		payload.value = m_context->CreateTempVariable(payload.type);
+
+		m_parser.SetCursor(payloadPosition);
+		return ReadImpl(payload.type, payload.value);
+	};
+
+	auto readValue = [&](const rttr::Type& type, void* adapterValue)
+	{
+		// Read value as converted type, payload member will be skipped as unknown property
+		m_parser.SetCursor(valuePosition);
+
+		if (nullptr == adapterValue)
+		{
+			m_parser.SkipValue();
+			return ReadResult::GenericFailResult();
+		}
+
+		return ReadImpl(type, adapterValue);
+	};
+
+	return ReadAdapterData(adapter, value, readPayload, readValue);
+}
+
+ReadResult CborReader::ReadArray(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::OKResult();
+
+	rttr::Type arrayType = type.GetArrayType();
+	uint8_t* arrayBytePtr = static_cast<uint8_t*>(value);
+	std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	if (m_parser.Peek() == detail::CborType::TypedArray)
+	{
+		detail::CborTypedArray typedArray;
+		if (!m_parser.ReadTypedArray(typedArray))
+			return ReadResult::GenericFailResult();
+
+		if (typedArray.kind == rttr::NumericKind::None || !arrayType.IsPlainNumeric())
+		{
+			RS_LOG_ERROR("Typed array items can't be read into array '%s'!", type.GetName());
+			return ReadResult::GenericFailResult();
+		}
+
+		if (typedArray.itemsCount > totalSize)
+		{
+			RS_LOG_WARNING("Actual array doesn't fit in target array size!");
+		}
+
+		ConvertTypedArrayItems(typedArray, arrayType.GetNumericKind(), value, std::min(typedArray.itemsCount, totalSize));
+		return result;
+	}
+
+	const char* arrayStart = m_parser.GetCursor();
+
+	detail::CborContainer items;
+	if (!m_parser.BeginArray(items))
+		return SkipMismatchedValue();
+
+	// Arrays of numbers are filled at once, skipping per item dispatch
+	if (arrayType.IsPlainNumeric() && !items.isIndefinite && items.itemsLeft <= totalSize)
+	{
+		if (ReadNumericItems(arrayType.GetNumericKind(), value, items.itemsLeft))
+			return result;
+
+		// Roll back and read items one by one
+		m_parser.SetCursor(arrayStart);
+		m_parser.BeginArray(items);
+	}
+
+	if (!items.isIndefinite && items.itemsLeft > totalSize)
+	{
+		RS_LOG_WARNING("Actual array doesn't fit in target array size!");
+	}
+
+	for (std::size_t i = 0U; m_parser.NextItem(items); ++i)
+	{
+		if (i >= totalSize)
+		{
+			// Remaining items still have to be consumed to keep parser in sync
+			m_parser.SkipValue();
+			continue;
+		}
+
+		uint8_t* itemPtr = arrayBytePtr + itemSize * i;
+		ReadResult itemResult = ReadImpl(arrayType, itemPtr);
+
+		if (!itemResult.Succeeded())
+		{
+			if (!itemResult.allEntitiesResolved)
+			{
+				result.allEntitiesResolved = false;
+			}
+		}
+	}
+
+	return result;
+}
+
+bool CborReader::ReadNumericItems(const rttr::NumericKind kind, void* items, const std::size_t count)
+{
+	return rttr::VisitNumericKind(kind, [this, items, count](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+
+		T* typedItems = static_cast<T*>(items);
+		for (std::size_t i = 0U; i < count; ++i)
+		{
+			if (!::ReadNumber(m_parser, typedItems[i]))
+				return false;
+		}
+
+		return true;
+	});
+}
+
+ReadResult CborReader::ReadNumber(const rttr::Type& type, void* value)
+{
+	const bool isRead = rttr::VisitNumericKind(type.GetNumericKind(), [this, value](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+		return ::ReadNumber(m_parser, *static_cast<T*>(value));
+	});
+
+	return isRead ? ReadResult::OKResult() : SkipMismatchedValue();
+}
+
+ReadResult CborReader::ReadStdString(void* value)
+{
+	switch (m_parser.Peek())
+	{
+		case detail::CborType::Null:
+		{
+			m_parser.ReadNull();
+			*static_cast<std::string*>(value) = std::string();
+			return ReadResult::OKResult();
+		}
+		case detail::CborType::TextString:
+		{
+			std::string_view str;
+			if (m_parser.ReadText(str))
+			{
+				static_cast<std::string*>(value)->assign(str.data(), str.size());
+				return ReadResult::OKResult();
+			}
+		}
+		break;
+		default:
+			return SkipMismatchedValue();
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult CborReader::ReadCString(void* value)
+{
+	char** strSerializedValue = reinterpret_cast<char**>(value);
+
+	switch (m_parser.Peek())
+	{
+		case detail::CborType::Null:
+		{
+			m_parser.ReadNull();
+			*strSerializedValue = nullptr;
+			return ReadResult::OKResult();
+		}
+		case detail::CborType::TextString:
+		{
+			std::string_view str;
+			if (m_parser.ReadText(str))
+			{
+				const std::string& storedStr = m_cStringsStorage.emplace_back(str);
+				*strSerializedValue = const_cast<char*>(storedStr.c_str());
+				return ReadResult::OKResult();
+			}
+		}
+		break;
+		default:
+			return SkipMismatchedValue();
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult CborReader::ReadImpl(const rttr::Type& type, void* value)
+{
+	assert(m_isOk);
+
+	// Predefined types are resolved with codec slot of the type
+	switch (type.GetPredefinedType())
+	{
+		case rs::PredefinedType::StdString:
+			return ReadStdString(value);
+		case rs::PredefinedType::CString:
+			return ReadCString(value);
+		default:
+			break;
+	}
+
+	ReadResult result = ReadResult::GenericFailResult();
+	rs::SerializationMethod serializationMethod = type.GetSerializationMethod();
+
+	switch (serializationMethod)
+	{
+		case rs::SerializationMethod::Proxy:
+		{
+			rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+			if (nullptr != proxyTypeData)
+			{
+				result = ReadProxy(proxyTypeData, value);
+			}
+			else
+			{
+				m_parser.SkipValue();
+			}
+		}
+		break;
+		case rs::SerializationMethod::Adapter:
+		{
+			SerializationAdapter* adapter = type.GetSerializationAdapter();
+			if (nullptr != adapter)
+			{
+				result = ReadAdapter(adapter, value);
+			}
+			else
+			{
+				m_parser.SkipValue();
+			}
+		}
+		break;
+		default:
+		{
+			switch (type.GetTypeClass())
+			{
+				case rttr::TypeClass::Object:
+				{
+					const detail::CborType valueType = m_parser.Peek();
+
+					if (valueType == detail::CborType::Map)
+					{
+						// Bases, properties and collection items are all read in a single pass over map members
+						result = ReadObjectProperties(type, value);
+					}
+					else if ((valueType == detail::CborType::Array || valueType == detail::CborType::TypedArray) && type.IsCollection() && type.GetPropertiesCount() == 0U)
+					{
+						// If this type has no properties, and written as array, use it as items container
+						result = ReadCollection(type, value);
+					}
+					else
+					{
+						result = SkipMismatchedValue();
+					}
+				}
+				break;
+				case rttr::TypeClass::Pointer:
+				{
+					result = ReadPointer(type, value);
+				}
+				break;
+				case rttr::TypeClass::Enum:
+				{
+					rttr::Type enumUnderlyingType = type.GetEnumUnderlyingType();
+					result = ReadImpl(enumUnderlyingType, value);
+				}
+				break;
+				case rttr::TypeClass::Real:
+				case rttr::TypeClass::Integral:
+				{
+					result = ReadNumber(type, value);
+				}
+				break;
+				case rttr::TypeClass::Array:
+				{
+					result = ReadArray(type, value);
+				}
+				break;
+				default:
+				{
+					result = SkipMismatchedValue();
+				}
+				break;
+			}
+		}
+		break;
+	}
+
+	return result;
+}
+
+bool CborReader::IsOk() const
+{
+	return m_isOk;
+}
+
+} // namespace rs
@@ -0,0 +1,80 @@
+#pragma once
+#include "readers/BaseReader.hpp"
+#include "readers/CborParser.hpp"
+#include "readers/InputSource.hpp"
+#include "readers/ObjectShapeCache.hpp"
+#include "rttr/Type.hpp"
+
+#include <istream>
+#include <string>
+#include <deque>
+#include <unordered_map>
+
+namespace rs
+{
+
+/*
+* @brief CBOR reader implementation
+*
+* Reads documents of the same structure as MessagePack ones (see CborWriter), values are decoded straight from source memory.
+* Typed arrays are copied into contiguous collections and arrays of numbers at once, when item type and byte order match,
+* and converted item by item otherwise, so data written by other producers or on other hosts is read as well.
+*/
+class CborReader
+	: public BaseReader
+{
+public:
+	explicit RAVEN_SERIALIZE_API CborReader(std::istream& stream);
+	explicit RAVEN_SERIALIZE_API CborReader(std::string content);
+	// Reads directly from source memory, for example from MappedFileInputSource, source is kept alive by the reader
+	explicit RAVEN_SERIALIZE_API CborReader(std::unique_ptr<InputSource>&& source);
+	RAVEN_SERIALIZE_API ~CborReader() = default;
+
+	bool RAVEN_SERIALIZE_API IsOk() const final;
+
+protected:
+	void DoRead(const rttr::Type& type, void* value) final;
+	bool CheckSourceHasObjectsList() final;
+
+private:
+	void InitParser();
+
+	// Primary function to read any object type, consumes exactly one value from the parser
+	ReadResult ReadImpl(const rttr::Type& type, void* value);
+
+	// Scans root map for context objects list, and builds objects index if it's present
+	bool IndexContextObjects(uint64_t& masterObjectId);
+	void ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const char* objectValuePosition);
+
+	ReadResult ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value);
+	ReadResult ReadAdapter(rs::SerializationAdapter* adapter, void* value);
+	// Read map members in the order they appear in source, dispatching them to properties, bases or collection items
+	ReadResult ReadObjectProperties(const rttr::Type& type, void* value);
+	ReadResult ReadCollection(const rttr::Type& type, void* value);
+	ReadResult ReadObjectBases(const rttr::Type& type, void* value);
+	ReadResult ReadPointer(const rttr::Type& type, void* value);
+	ReadResult ReadArray(const rttr::Type& type, void* value);
+	// Reads count numbers straight into items storage, parser position is undefined on failure
+	bool ReadNumericItems(const rttr::NumericKind kind, void* items, const std::size_t count);
+	// Reads typed array into collection of numbers, items are converted if their type differs
+	ReadResult ReadTypedArrayCollection(const rttr::Type& type, void* value);
+	// Reads integral or real value, converted straight to the destination width
+	ReadResult ReadNumber(const rttr::Type& type, void* value);
+	ReadResult ReadStdString(void* value);
+	ReadResult ReadCString(void* value);
+
+	// Skips current value and returns failed result, used to keep parser in sync on type mismatch
+	ReadResult SkipMismatchedValue();
+
+private:
+	std::unique_ptr<InputSource> m_source;
+	detail::CborParser m_parser;
+	// Position of context object '$val$' value by object id
+	std::unordered_map<uint64_t, const char*> m_contextObjectsIndex;
+	detail::ObjectShapeCache m_shapeCache;
+	// Storage for strings, read as const char*, they must outlive the reader
+	std::deque<std::string> m_cStringsStorage;
+	bool m_isOk = false;
+};
+
+} // namespace rs
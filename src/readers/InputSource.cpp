@@ -0,0 +1,146 @@
+#include "readers/InputSource.hpp"
+#include "rs/log/Log.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace rs
+{
+
+MemoryInputSource::MemoryInputSource(std::string content)
+	: m_content(std::move(content))
+{}
+
+const char* MemoryInputSource::GetData() const
+{
+	return m_content.data();
+}
+
+std::size_t MemoryInputSource::GetSize() const
+{
+	return m_content.size();
+}
+
+bool MemoryInputSource::IsOk() const
+{
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+MappedFileInputSource::MappedFileInputSource(const char* filePath)
+{
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		RS_LOG_ERROR("Failed to open file '%s'!", filePath);
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(fileHandle, &fileSize))
+	{
+		m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+		if (m_size > 0U)
+		{
+			HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (nullptr != mappingHandle)
+			{
+				// Mapped view keeps the mapping object alive, so handle can be closed right away
+				m_data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+				CloseHandle(mappingHandle);
+			}
+
+			m_isOk = (nullptr != m_data);
+		}
+		else
+		{
+			m_isOk = true;
+		}
+	}
+
+	CloseHandle(fileHandle);
+#else
+	int fileDescriptor = open(filePath, O_RDONLY);
+	if (fileDescriptor < 0)
+	{
+		RS_LOG_ERROR("Failed to open file '%s'!", filePath);
+		return;
+	}
+
+	struct stat fileStat;
+	if (fstat(fileDescriptor, &fileStat) == 0)
+	{
+		m_size = static_cast<std::size_t>(fileStat.st_size);
+
+		if (m_size > 0U)
+		{
+			void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mapping != MAP_FAILED)
+			{
+				madvise(mapping, m_size, MADV_SEQUENTIAL);
+				m_data = static_cast<const char*>(mapping);
+			}
+
+			m_isOk = (nullptr != m_data);
+		}
+		else
+		{
+			m_isOk = true;
+		}
+	}
+
+	// Mapping stays valid after file descriptor is closed
+	close(fileDescriptor);
+#endif
+
+	if (!m_isOk)
+	{
+		RS_LOG_ERROR("Failed to map file '%s'!", filePath);
+		m_size = 0U;
+	}
+}
+
+MappedFileInputSource::~MappedFileInputSource()
+{
+	if (nullptr != m_data)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_data);
+#else
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+	}
+}
+
+const char* MappedFileInputSource::GetData() const
+{
+	return m_data;
+}
+
+std::size_t MappedFileInputSource::GetSize() const
+{
+	return m_size;
+}
+
+bool MappedFileInputSource::IsOk() const
+{
+	return m_isOk;
+}
+
+std::unique_ptr<MappedFileInputSource> MappedFileInputSource::Open(const char* filePath)
+{
+	return std::make_unique<MappedFileInputSource>(filePath);
+}
+
+} // namespace rs
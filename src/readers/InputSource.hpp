@@ -0,0 +1,71 @@
+#pragma once
+#include "raven_serialize_export.h"
+
+#include <string>
+#include <memory>
+#include <cstddef>
+
+namespace rs
+{
+
+/*
+* @brief Contiguous read-only source of serialized data
+*
+* Readers parse directly from the memory provided by the source, so source must outlive the parsing
+*/
+class InputSource
+{
+public:
+	virtual ~InputSource() = default;
+
+	virtual const char* GetData() const = 0;
+	virtual std::size_t GetSize() const = 0;
+	virtual bool IsOk() const = 0;
+};
+
+/*
+* @brief Input source owning in-memory content
+*/
+class MemoryInputSource
+	: public InputSource
+{
+public:
+	explicit RAVEN_SERIALIZE_API MemoryInputSource(std::string content);
+
+	RAVEN_SERIALIZE_API const char* GetData() const final;
+	std::size_t RAVEN_SERIALIZE_API GetSize() const final;
+	bool RAVEN_SERIALIZE_API IsOk() const final;
+
+private:
+	std::string m_content;
+};
+
+/*
+* @brief Input source mapping the whole file into memory read-only
+*
+* File pages are loaded on demand by the OS as parser walks through them, and no copy of file content is made.
+* Mapping is hinted for sequential access.
+*/
+class MappedFileInputSource
+	: public InputSource
+{
+public:
+	explicit RAVEN_SERIALIZE_API MappedFileInputSource(const char* filePath);
+	RAVEN_SERIALIZE_API ~MappedFileInputSource();
+
+	MappedFileInputSource(const MappedFileInputSource&) = delete;
+	MappedFileInputSource& operator=(const MappedFileInputSource&) = delete;
+
+	RAVEN_SERIALIZE_API const char* GetData() const final;
+	std::size_t RAVEN_SERIALIZE_API GetSize() const final;
+	bool RAVEN_SERIALIZE_API IsOk() const final;
+
+	static RAVEN_SERIALIZE_API std::unique_ptr<MappedFileInputSource> Open(const char* filePath);
+
+private:
+	const char* m_data = nullptr;
+	std::size_t m_size = 0U;
+	bool m_isOk = false;
+};
+
+} // namespace rs
@@ -0,0 +1,567 @@
+#include "readers/JsonPullParser.hpp"
+
+#include <cstring>
+#include <cstdint>
+
+namespace
+{
+
+bool IsDigit(const char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+int HexDigitValue(const char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+
+	return -1;
+}
+
+void AppendUtf8(std::string& str, uint32_t codepoint)
+{
+	if (codepoint < 0x80)
+	{
+		str.push_back(static_cast<char>(codepoint));
+	}
+	else if (codepoint < 0x800)
+	{
+		str.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+		str.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+	}
+	else if (codepoint < 0x10000)
+	{
+		str.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+		str.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+		str.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+	}
+	else
+	{
+		str.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+		str.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+		str.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+		str.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+	}
+}
+
+}
+
+namespace rs
+{
+namespace detail
+{
+
+JsonPullParser::JsonPullParser(const char* begin, const char* end)
+	: m_begin(begin)
+	, m_cursor(begin)
+	, m_end(end)
+{}
+
+void JsonPullParser::SkipWhitespace()
+{
+	while (m_cursor < m_end)
+	{
+		const char c = *m_cursor;
+		if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+		{
+			++m_cursor;
+		}
+		else
+		{
+			break;
+		}
+	}
+}
+
+bool JsonPullParser::Fail()
+{
+	m_hasError = true;
+	return false;
+}
+
+bool JsonPullParser::Expect(const char c)
+{
+	SkipWhitespace();
+
+	if (m_cursor < m_end && *m_cursor == c)
+	{
+		++m_cursor;
+		return true;
+	}
+
+	return Fail();
+}
+
+JsonTokenType JsonPullParser::Peek()
+{
+	if (m_hasError)
+		return JsonTokenType::Invalid;
+
+	SkipWhitespace();
+	if (m_cursor >= m_end)
+		return JsonTokenType::Invalid;
+
+	switch (*m_cursor)
+	{
+		case '{':
+			return JsonTokenType::Object;
+		case '[':
+			return JsonTokenType::Array;
+		case '"':
+			return JsonTokenType::String;
+		case 'n':
+			return JsonTokenType::Null;
+		case 't':
+		case 'f':
+			return JsonTokenType::Boolean;
+		case '-':
+			return JsonTokenType::Number;
+		default:
+			return IsDigit(*m_cursor) ? JsonTokenType::Number : JsonTokenType::Invalid;
+	}
+}
+
+bool JsonPullParser::SkipLiteral(const char* literal, const std::size_t length)
+{
+	if (static_cast<std::size_t>(m_end - m_cursor) >= length && std::memcmp(m_cursor, literal, length) == 0)
+	{
+		m_cursor += length;
+		m_containerOpened = false;
+		return true;
+	}
+
+	return Fail();
+}
+
+bool JsonPullParser::ReadNull()
+{
+	if (Peek() != JsonTokenType::Null)
+		return Fail();
+
+	return SkipLiteral("null", 4U);
+}
+
+bool JsonPullParser::ReadBool(bool& value)
+{
+	if (Peek() != JsonTokenType::Boolean)
+		return Fail();
+
+	value = (*m_cursor == 't');
+	return value ? SkipLiteral("true", 4U) : SkipLiteral("false", 5U);
+}
+
+bool JsonPullParser::ReadNumber(std::string_view& token, bool& isInteger)
+{
+	if (Peek() != JsonTokenType::Number)
+		return Fail();
+
+	const char* start = m_cursor;
+	isInteger = true;
+
+	if (*m_cursor == '-')
+	{
+		++m_cursor;
+	}
+
+	const char* digitsStart = m_cursor;
+	while (m_cursor < m_end && IsDigit(*m_cursor))
+	{
+		++m_cursor;
+	}
+
+	if (m_cursor == digitsStart)
+		return Fail();
+
+	if (m_cursor < m_end && *m_cursor == '.')
+	{
+		isInteger = false;
+		++m_cursor;
+
+		const char* fractionStart = m_cursor;
+		while (m_cursor < m_end && IsDigit(*m_cursor))
+		{
+			++m_cursor;
+		}
+
+		if (m_cursor == fractionStart)
+			return Fail();
+	}
+
+	if (m_cursor < m_end && (*m_cursor == 'e' || *m_cursor == 'E'))
+	{
+		isInteger = false;
+		++m_cursor;
+
+		if (m_cursor < m_end && (*m_cursor == '+' || *m_cursor == '-'))
+		{
+			++m_cursor;
+		}
+
+		const char* exponentStart = m_cursor;
+		while (m_cursor < m_end && IsDigit(*m_cursor))
+		{
+			++m_cursor;
+		}
+
+		if (m_cursor == exponentStart)
+			return Fail();
+	}
+
+	token = std::string_view(start, static_cast<std::size_t>(m_cursor - start));
+	m_containerOpened = false;
+	return true;
+}
+
+bool JsonPullParser::ReadStringInternal(std::string_view& value, std::string& scratch)
+{
+	if (Peek() != JsonTokenType::String)
+		return Fail();
+
+	++m_cursor;
+	const char* start = m_cursor;
+
+	// Fast path, string without escape sequences is returned as view into the source buffer
+	while (m_cursor < m_end && *m_cursor != '"' && *m_cursor != '\\')
+	{
+		++m_cursor;
+	}
+
+	if (m_cursor >= m_end)
+		return Fail();
+
+	if (*m_cursor == '"')
+	{
+		value = std::string_view(start, static_cast<std::size_t>(m_cursor - start));
+		++m_cursor;
+		m_containerOpened = false;
+		return true;
+	}
+
+	// Slow path, decode escape sequences into scratch storage
+	scratch.assign(start, m_cursor);
+
+	while (m_cursor < m_end && *m_cursor != '"')
+	{
+		const char c = *m_cursor++;
+		if (c != '\\')
+		{
+			scratch.push_back(c);
+			continue;
+		}
+
+		if (m_cursor >= m_end)
+			return Fail();
+
+		const char escaped = *m_cursor++;
+		switch (escaped)
+		{
+			case '"': scratch.push_back('"'); break;
+			case '\\': scratch.push_back('\\'); break;
+			case '/': scratch.push_back('/'); break;
+			case 'b': scratch.push_back('\b'); break;
+			case 'f': scratch.push_back('\f'); break;
+			case 'n': scratch.push_back('\n'); break;
+			case 'r': scratch.push_back('\r'); break;
+			case 't': scratch.push_back('\t'); break;
+			case 'u':
+			{
+				auto readCodeUnit = [this](uint32_t& codeUnit) -> bool
+				{
+					if (m_end - m_cursor < 4)
+						return false;
+
+					codeUnit = 0U;
+					for (int i = 0; i < 4; ++i)
+					{
+						const int digit = HexDigitValue(m_cursor[i]);
+						if (digit < 0)
+							return false;
+
+						codeUnit = (codeUnit << 4) | static_cast<uint32_t>(digit);
+					}
+
+					m_cursor += 4;
+					return true;
+				};
+
+				uint32_t codepoint = 0U;
+				if (!readCodeUnit(codepoint))
+					return Fail();
+
+				// Combine surrogate pair into single codepoint
+				if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+				{
+					uint32_t lowSurrogate = 0U;
+					if (m_end - m_cursor < 2 || m_cursor[0] != '\\' || m_cursor[1] != 'u')
+						return Fail();
+
+					m_cursor += 2;
+					if (!readCodeUnit(lowSurrogate) || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+						return Fail();
+
+					codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+				}
+
+				AppendUtf8(scratch, codepoint);
+			}
+			break;
+			default:
+				return Fail();
+		}
+	}
+
+	if (m_cursor >= m_end)
+		return Fail();
+
+	++m_cursor;
+	value = std::string_view(scratch);
+	m_containerOpened = false;
+	return true;
+}
+
+bool JsonPullParser::ReadString(std::string_view& value)
+{
+	return ReadStringInternal(value, m_valueScratch);
+}
+
+bool JsonPullParser::BeginObject()
+{
+	if (Peek() != JsonTokenType::Object)
+		return Fail();
+
+	++m_cursor;
+	m_containerOpened = true;
+	return true;
+}
+
+bool JsonPullParser::NextMember(std::string_view& key)
+{
+	if (m_hasError)
+		return false;
+
+	SkipWhitespace();
+	if (m_cursor >= m_end)
+		return Fail();
+
+	if (*m_cursor == '}')
+	{
+		++m_cursor;
+		m_containerOpened = false;
+		return false;
+	}
+
+	// Members after the first one must be separated with comma
+	if (!m_containerOpened && !Expect(','))
+		return false;
+
+	if (!ReadStringInternal(key, m_keyScratch))
+		return false;
+
+	return Expect(':');
+}
+
+bool JsonPullParser::BeginArray()
+{
+	if (Peek() != JsonTokenType::Array)
+		return Fail();
+
+	++m_cursor;
+	m_containerOpened = true;
+	return true;
+}
+
+bool JsonPullParser::NextItem()
+{
+	if (m_hasError)
+		return false;
+
+	SkipWhitespace();
+	if (m_cursor >= m_end)
+		return Fail();
+
+	if (*m_cursor == ']')
+	{
+		++m_cursor;
+		m_containerOpened = false;
+		return false;
+	}
+
+	if (!m_containerOpened && !Expect(','))
+		return false;
+
+	m_containerOpened = false;
+	return true;
+}
+
+bool JsonPullParser::SkipString()
+{
+	++m_cursor;
+
+	while (m_cursor < m_end)
+	{
+		const char c = *m_cursor++;
+		if (c == '"')
+		{
+			return true;
+		}
+		else if (c == '\\')
+		{
+			++m_cursor;
+		}
+	}
+
+	return Fail();
+}
+
+bool JsonPullParser::SkipValue()
+{
+	switch (Peek())
+	{
+		case JsonTokenType::Null:
+			return SkipLiteral("null", 4U);
+		case JsonTokenType::Boolean:
+			return (*m_cursor == 't') ? SkipLiteral("true", 4U) : SkipLiteral("false", 5U);
+		case JsonTokenType::Number:
+		{
+			std::string_view token;
+			bool isInteger = false;
+			return ReadNumber(token, isInteger);
+		}
+		case JsonTokenType::String:
+		{
+			if (!SkipString())
+				return false;
+
+			m_containerOpened = false;
+			return true;
+		}
+		case JsonTokenType::Array:
+		case JsonTokenType::Object:
+		{
+			// Containers are skipped by brackets balance only, nested tokens are not validated
+			std::size_t depth = 0U;
+
+			while (m_cursor < m_end)
+			{
+				const char c = *m_cursor;
+				if (c == '"')
+				{
+					if (!SkipString())
+						return false;
+
+					continue;
+				}
+
+				++m_cursor;
+
+				if (c == '{' || c == '[')
+				{
+					++depth;
+				}
+				else if (c == '}' || c == ']')
+				{
+					if (--depth == 0U)
+					{
+						m_containerOpened = false;
+						return true;
+					}
+				}
+			}
+
+			return Fail();
+		}
+		default:
+			return Fail();
+	}
+}
+
+const char* JsonPullParser::FindMemberValue(const char* objectStart, std::string_view key)
+{
+	const char* savedCursor = m_cursor;
+	const bool savedContainerOpened = m_containerOpened;
+	const char* valuePosition = nullptr;
+
+	m_cursor = objectStart;
+
+	if (BeginObject())
+	{
+		std::string_view memberKey;
+		while (NextMember(memberKey))
+		{
+			if (memberKey == key)
+			{
+				SkipWhitespace();
+				valuePosition = m_cursor;
+				break;
+			}
+
+			if (!SkipValue())
+				break;
+		}
+	}
+
+	m_cursor = savedCursor;
+	m_containerOpened = savedContainerOpened;
+
+	return valuePosition;
+}
+
+std::size_t JsonPullParser::CountArrayItems(const char* arrayStart)
+{
+	const char* savedCursor = m_cursor;
+	const bool savedContainerOpened = m_containerOpened;
+	std::size_t count = 0U;
+
+	m_cursor = arrayStart;
+
+	if (BeginArray())
+	{
+		while (NextItem())
+		{
+			if (!SkipValue())
+				break;
+
+			++count;
+		}
+	}
+
+	m_cursor = savedCursor;
+	m_containerOpened = savedContainerOpened;
+
+	return count;
+}
+
+const char* JsonPullParser::GetCursor() const
+{
+	return m_cursor;
+}
+
+void JsonPullParser::SetCursor(const char* cursor)
+{
+	m_cursor = cursor;
+	m_containerOpened = false;
+}
+
+bool JsonPullParser::IsAtEnd()
+{
+	SkipWhitespace();
+	return m_cursor >= m_end;
+}
+
+bool JsonPullParser::HasError() const
+{
+	return m_hasError;
+}
+
+std::size_t JsonPullParser::GetErrorOffset() const
+{
+	return static_cast<std::size_t>(m_cursor - m_begin);
+}
+
+} // namespace detail
+} // namespace rs
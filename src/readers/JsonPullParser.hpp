@@ -0,0 +1,91 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace rs
+{
+namespace detail
+{
+
+enum class JsonTokenType
+{
+	Invalid,
+	Null,
+	Boolean,
+	Number,
+	String,
+	Array,
+	Object,
+};
+
+/*
+* @brief Pull parser over contiguous json text
+*
+* Parser doesn't build any document tree, it only walks the source buffer on demand, so reader can materialize
+* values directly from tokens. The only state parser keeps is a cursor and a flag telling if container has just
+* been opened, so any value start position can be saved and restored to re-read the value later.
+*/
+class JsonPullParser
+{
+public:
+	JsonPullParser() = default;
+	JsonPullParser(const char* begin, const char* end);
+
+	// Skips whitespace and returns the type of next value without consuming it
+	JsonTokenType Peek();
+
+	bool ReadNull();
+	bool ReadBool(bool& value);
+	// Reads raw number token, returned view points to the source buffer
+	bool ReadNumber(std::string_view& token, bool& isInteger);
+	// Reads string value, view points to the source buffer if there are no escape sequences, or to scratch storage otherwise
+	// Scratch storage is reused by next string read, so value must be copied before reading further
+	bool ReadString(std::string_view& value);
+
+	// Object traversal: BeginObject consumes '{', then NextMember is called until it returns false
+	// After NextMember returned true, caller must consume member value (read it or skip it)
+	bool BeginObject();
+	bool NextMember(std::string_view& key);
+
+	// Array traversal: BeginArray consumes '[', then NextItem is called until it returns false
+	bool BeginArray();
+	bool NextItem();
+
+	// Skips the next value of any kind, nested containers are skipped without building anything
+	bool SkipValue();
+
+	// Looks for the member with given key in the object starting at objectStart, doesn't move the cursor
+	// Returns member value position, or nullptr if object has no such member
+	const char* FindMemberValue(const char* objectStart, std::string_view key);
+	// Counts items of the array starting at arrayStart, doesn't move the cursor
+	std::size_t CountArrayItems(const char* arrayStart);
+
+	const char* GetCursor() const;
+	// Cursor can only be restored to the position of some value start
+	void SetCursor(const char* cursor);
+
+	bool IsAtEnd();
+	bool HasError() const;
+	std::size_t GetErrorOffset() const;
+
+private:
+	void SkipWhitespace();
+	bool Expect(const char c);
+	bool ReadStringInternal(std::string_view& value, std::string& scratch);
+	bool SkipString();
+	bool SkipLiteral(const char* literal, const std::size_t length);
+	bool Fail();
+
+private:
+	const char* m_begin = nullptr;
+	const char* m_cursor = nullptr;
+	const char* m_end = nullptr;
+	std::string m_keyScratch;
+	std::string m_valueScratch;
+	bool m_containerOpened = false;
+	bool m_hasError = false;
+};
+
+} // namespace detail
+} // namespace rs
@@ -8,6 +8,7 @@
 
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 #include <codecvt>
+#include <array>
 
 namespace
 {
@@ -56,21 +57,80 @@ struct ConstCharStringJsonTypeResolver
 	}
 };
 
-std::unordered_map<std::type_index, std::unique_ptr<PredefinedJsonTypeResolver>> g_predefinedJsonTypeResolvers;
+// Resolvers are indexed by predefined type id stored in the type codec slot
+std::array<std::unique_ptr<PredefinedJsonTypeResolver>, static_cast<std::size_t>(rs::PredefinedType::Count)> g_predefinedJsonTypeResolvers;
 
 struct JsonTypeResolversInitContext
 {
 	JsonTypeResolversInitContext()
 	{
 		// Register predefined types resolvers
-		g_predefinedJsonTypeResolvers.emplace(typeid(std::string), std::make_unique<StdStringJsonTypeResolver>());
-		//m_predefinedJsonTypeResolvers.emplace(typeid(std::wstring), std::make_unique<StdStringJsonTypeResolver<std::wstring>>());
-		g_predefinedJsonTypeResolvers.emplace(typeid(const char*), std::make_unique<ConstCharStringJsonTypeResolver>());
+		g_predefinedJsonTypeResolvers[static_cast<std::size_t>(rs::PredefinedType::StdString)] = std::make_unique<StdStringJsonTypeResolver>();
+		g_predefinedJsonTypeResolvers[static_cast<std::size_t>(rs::PredefinedType::CString)] = std::make_unique<ConstCharStringJsonTypeResolver>();
 	}
 };
 
 const JsonTypeResolversInitContext typeResolversInitContext;
 
+//////////////////////////////////////////////////////////////////////////////////
+// Bulk numeric arrays reading
+
+template <typename T>
+bool ReadNumericItems(const Json::Value& jsonArray, T* items)
+{
+	for (const Json::Value& itemVal : jsonArray)
+	{
+		// Same conversions as for single values, anything unusual is left to generic path
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			switch (itemVal.type())
+			{
+			case Json::booleanValue:
+				*items = itemVal.asBool();
+				break;
+			case Json::intValue:
+			case Json::uintValue:
+			case Json::nullValue:
+				*items = !!itemVal.asUInt64();
+				break;
+			default:
+				return false;
+			}
+		}
+		else
+		{
+			if (!itemVal.isNumeric())
+				return false;
+
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				*items = static_cast<T>(itemVal.asDouble());
+			}
+			else if constexpr (std::is_signed_v<T>)
+			{
+				*items = static_cast<T>(itemVal.asInt64());
+			}
+			else
+			{
+				*items = static_cast<T>(itemVal.asUInt64());
+			}
+		}
+
+		++items;
+	}
+
+	return true;
+}
+
+bool ReadNumericItems(const Json::Value& jsonArray, const rttr::NumericKind kind, void* items)
+{
+	return rttr::VisitNumericKind(kind, [&jsonArray, items](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+		return ReadNumericItems(jsonArray, static_cast<T*>(items));
+	});
+}
+
 }
 
 namespace rs
@@ -89,18 +149,9 @@ JsonReader::JsonReader(std::istream& stream)
 		char* buffer = new char[bufferSize];
 		stream.read(buffer, bufferSize);
 
-		Json::CharReaderBuilder builder;
-		auto reader = builder.newCharReader();
-		std::string errorStr;
-
-		m_isOk = reader->parse(buffer, buffer + bufferSize, &m_jsonRoot, &errorStr);
-		if (!m_isOk)
-		{
-			Log::LogMessage(errorStr);
-		}
+		Parse(buffer, buffer + bufferSize);
 
 		delete[] buffer;
-		delete reader;
 	}
 	else
 	{
@@ -120,32 +171,53 @@ JsonReader::JsonReader(Json::Value&& jsonVal)
 {}
 
 JsonReader::JsonReader(const std::string& jsonContent)
+{
+	Parse(jsonContent.c_str(), jsonContent.c_str() + jsonContent.size());
+}
+
+JsonReader::JsonReader(std::unique_ptr<InputSource>&& source)
+{
+	if (source && source->IsOk() && source->GetSize() > 0U)
+	{
+		// Source is only needed while parsing, document tree owns all the data afterwards
+		Parse(source->GetData(), source->GetData() + source->GetSize());
+	}
+}
+
+void JsonReader::Parse(const char* begin, const char* end)
 {
 	Json::CharReaderBuilder builder;
-	Json::CharReader* reader = builder.newCharReader();
+	std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
 	std::string errorStr;
 
-	m_isOk = reader->parse(jsonContent.c_str(), jsonContent.c_str() + jsonContent.size(), &m_jsonRoot, &errorStr);
+	m_isOk = reader->parse(begin, end, &m_jsonRoot, &errorStr);
 	if (!m_isOk)
 	{
-		Log::LogMessage(errorStr);
+		RS_LOG_ERROR("%s", errorStr.c_str());
 	}
-
-	delete reader;
 }
 
-Json::Value const* JsonReader::FindContextJsonObject(const Json::Value& jsonRoot, const uint64_t id) const
+void JsonReader::IndexContextObjects(const Json::Value& contextObjectsVal)
 {
-	for (const Json::Value& val : jsonRoot)
+	m_contextObjectsIndex.clear();
+	m_contextObjectsIndex.reserve(contextObjectsVal.size());
+
+	for (const Json::Value& val : contextObjectsVal)
 	{
 		if (val.isObject() && val.isMember(K_CONTEXT_OBJ_ID) && val.isMember(K_CONTEXT_OBJ_VAL))
 		{
-			if (val[K_CONTEXT_OBJ_ID].asUInt64() == id)
-			{
-				return &val;
-			}
+			m_contextObjectsIndex.emplace(val[K_CONTEXT_OBJ_ID].asUInt64(), &val);
 		}
 	}
+}
+
+Json::Value const* JsonReader::FindContextJsonObject(const uint64_t id) const
+{
+	auto it = m_contextObjectsIndex.find(id);
+	if (it != m_contextObjectsIndex.end())
+	{
+		return it->second;
+	}
 
 	return nullptr;
 }
@@ -161,7 +233,7 @@ void JsonReader::ReadContextObject(const rttr::Type& type, void* value, const Js
 	}
 	else
 	{
-		Log::LogMessage("Failed to read context object!");
+		RS_LOG_ERROR("Failed to read context object!");
 	}
 }
 
@@ -173,75 +245,65 @@ void JsonReader::DoRead(const rttr::Type& type, void* value)
 		// Parse objects list
 		const Json::Value& contextObjectsVal = m_jsonRoot[K_CONTEXT_OBJECTS];
 		uint64_t masterObjectId = m_jsonRoot[K_MASTER_OBJ_ID].asUInt64();
-		Json::Value const* masterObjectVal = nullptr;
 
-		// Find master object json val
-		for (const Json::Value& contextObjectVal : contextObjectsVal)
+		// Document tree doesn't change after it's parsed, so index is built once per reader
+		if (m_contextObjectsIndex.empty())
 		{
-			if (contextObjectVal.isMember(K_CONTEXT_OBJ_ID) && contextObjectVal.isMember(K_CONTEXT_OBJ_VAL) && contextObjectVal[K_CONTEXT_OBJ_ID].asUInt64() == masterObjectId)
-			{
-				masterObjectVal = &contextObjectVal;
-				break;
-			}
+			IndexContextObjects(contextObjectsVal);
 		}
 
+		// Find master object json val
+		Json::Value const* masterObjectVal = FindContextJsonObject(masterObjectId);
+
 		if (nullptr != masterObjectVal)
 		{
-			// Parse master object
+			// Parse master object, it's marked as visited first, so references to it are not queued
+			MarkContextObjectVisited(masterObjectId);
 			ReadContextObject(type, value, *masterObjectVal);
-			FilterReferencedObjectsList(m_referencedContextObjects);
 
-			while (!m_referencedContextObjects.empty())
+			// Handle referenced context objects, each of them is queued only once, so every object is loaded exactly one time
+			std::pair<uint64_t, rttr::Type> objectReference;
+			while (PopPendingContextObject(objectReference))
 			{
-				// Handle referenced context objects
-				for (const auto& objectReference : m_referencedContextObjects)
+				bool contextObjectValid = false;
+
+				// Find object in context
+				Json::Value const* contextJsonObjectPtr = FindContextJsonObject(objectReference.first);
+				if (nullptr != contextJsonObjectPtr)
 				{
-					bool objectAlreadyLoaded = !!m_context->GetObjectById(objectReference.first);
-					if (!objectAlreadyLoaded)
-					{
-						bool contextObjectValid = false;
+					const Json::Value& contextJsonObject = *contextJsonObjectPtr;
+					rttr::Type pointedType = objectReference.second;
 
-						// Find object in context
-						Json::Value const* contextJsonObjectPtr = FindContextJsonObject(contextObjectsVal, objectReference.first);
-						if (nullptr != contextJsonObjectPtr)
+					if (pointedType.IsValid())
+					{
+						// Check actual type of polymorphic type
+						if (pointedType.IsPolymorphic() && contextJsonObject[K_CONTEXT_OBJ_VAL].isMember(K_TYPE_ID))
 						{
-							const Json::Value& contextJsonObject = *contextJsonObjectPtr;
-							rttr::Type pointedType = objectReference.second;
-
-							if (pointedType.IsValid())
+							rttr::Type deducedType = rttr::Reflect(contextJsonObject[K_CONTEXT_OBJ_VAL][K_TYPE_ID].asCString());
+							if (deducedType.IsValid() && deducedType.IsBaseClass(pointedType))
 							{
-								// Check actual type of polymorphic type
-								if (pointedType.IsPolymorphic() && contextJsonObject[K_CONTEXT_OBJ_VAL].isMember(K_TYPE_ID))
-								{
-									rttr::Type deducedType = rttr::Reflect(contextJsonObject[K_CONTEXT_OBJ_VAL][K_TYPE_ID].asCString());
-									if (deducedType.IsValid() && deducedType.IsBaseClass(pointedType))
-									{
-										pointedType = deducedType;
-									}
-								}
-
-								void* pointedValue = pointedType.Instantiate();
-								if (nullptr != pointedValue)
-								{
-									ReadContextObject(pointedType, pointedValue, contextJsonObject);
-									contextObjectValid = true;
-								}
+								pointedType = deducedType;
 							}
 						}
 
-						if (!contextObjectValid)
+						void* pointedValue = pointedType.Instantiate();
+						if (nullptr != pointedValue)
 						{
-							m_context->AddObject(objectReference.first, objectReference.second, nullptr);
+							ReadContextObject(pointedType, pointedValue, contextJsonObject);
+							contextObjectValid = true;
 						}
 					}
 				}
 
-				FilterReferencedObjectsList(m_referencedContextObjects);
+				if (!contextObjectValid)
+				{
+					m_context->AddObject(objectReference.first, objectReference.second, nullptr);
+				}
 			}
 		}
 		else
 		{
-			Log::LogMessage("Master object not found in the context objects list!");
+			RS_LOG_ERROR("Master object not found in the context objects list!");
 		}
 	}
 	else
@@ -283,7 +345,7 @@ ReadResult JsonReader::ReadObjectBases(const rttr::Type& type, void* value, cons
 
 			if (!baseClassResolved)
 			{
-				Log::LogMessage("Base class '%s' not resolved!", baseClass.GetName());
+				RS_LOG_ERROR("Base class '%s' not resolved!", baseClass.GetName());
 			}
 		}
 	}
@@ -291,69 +353,95 @@ ReadResult JsonReader::ReadObjectBases(const rttr::Type& type, void* value, cons
 	return result;
 }
 
-ReadResult JsonReader::ReadObjectProperties(const rttr::Type& type, void* value, const Json::Value& jsonVal, std::size_t propertiesCount)
+ReadResult JsonReader::ReadObjectProperties(const rttr::Type& type, void* value, const Json::Value& jsonVal)
 {
 	ReadResult result = ReadResult::OKResult(); // If we have no properties, it's OK
 
-	for (std::size_t i = 0U; i < propertiesCount; ++i)
+	if (!jsonVal.isObject())
 	{
-		rttr::Property* property = type.GetProperty(i);
-		const rttr::Type& propertyType = property->GetType();
-		const char* propertyName = property->GetName();
+		return result;
+	}
+
+	// Walk json members once, and match each of them to the property using shape of the previous object of this type,
+	// members not matching any property (like reserved keywords) are ignored. Matched members are read in property
+	// declaration order, as json members are sorted by name, and mutators are expected to be called in declaration order
+	detail::ObjectShapeCache::Shape& shape = m_shapeCache.GetShape(type);
+	const std::size_t propertiesCount = type.GetPropertiesCount();
+
+	// Nested objects use the same list above this object's slots, so slots are accessed by index
+	const std::size_t slotsBegin = m_propertyValues.size();
+	m_propertyValues.resize(slotsBegin + propertiesCount, nullptr);
 
-		Log::LogMessage("Reading property '%s::%s'", type.GetName(), propertyName);
+	std::size_t memberPosition = 0U;
+	for (auto it = jsonVal.begin(); it != jsonVal.end(); ++it, ++memberPosition)
+	{
+		const char* memberNameEnd = nullptr;
+		const char* memberName = it.memberName(&memberNameEnd);
 
-		if (jsonVal.isObject() && jsonVal.isMember(propertyName))
+		const std::size_t propertyIdx = shape.Resolve(type, memberPosition, std::string_view(memberName, static_cast<std::size_t>(memberNameEnd - memberName)));
+		if (propertyIdx != rttr::k_invalidPropertyIndex)
 		{
-			const Json::Value& itemJsonVal = jsonVal[propertyName];
+			m_propertyValues[slotsBegin + propertyIdx] = &(*it);
+		}
+	}
 
-			// Decide to create temp variable or not
-			void* propertyValuePtr = nullptr;
-			bool needsTempVar = property->NeedsTempVariable();
+	for (std::size_t propertyIdx = 0U; propertyIdx < propertiesCount; ++propertyIdx)
+	{
+		const Json::Value* propertyJsonVal = m_propertyValues[slotsBegin + propertyIdx];
+		if (nullptr == propertyJsonVal)
+		{
+			continue;
+		}
 
-			if (needsTempVar)
-			{
-				propertyValuePtr = m_context->CreateTempVariable(property->GetType());
-			}
-			else
-			{
-				propertyValuePtr = property->GetValueAddress(value);
-			}
+		rttr::Property* property = type.GetProperty(propertyIdx);
+		const rttr::Type& propertyType = property->GetType();
+		const Json::Value& itemJsonVal = *propertyJsonVal;
 
-			// Read value
-			ReadResult propertyReadResult = ReadImpl(propertyType, propertyValuePtr, itemJsonVal);
+		RS_LOG_TRACE("Reading property '%s::%s'", type.GetName(), property->GetName());
 
-			if (propertyReadResult.Succeeded())
-			{
-				// We have succeeded, now call property mutator function to apply temp
-				property->CallMutator(value, const_cast<void*>(propertyValuePtr));
+		// Decide to create temp variable or not
+		void* propertyValuePtr = nullptr;
+		bool needsTempVar = property->NeedsTempVariable();
 
-				// As we already applied value to target, we can release temp variable
-				if (needsTempVar)
-				{
-					m_context->DestroyTempVariable(propertyValuePtr);
-				}
-			}
-			else
-			{
-				if (!propertyReadResult.allEntitiesResolved)
-				{
-					// If not all property value entities are resolved, make use of deferred commands list
-					auto callMutatorAction = std::make_unique<detail::CallObjectMutatorAction>(0, property, value, propertyValuePtr);
-					m_deferredCommandsList.push_back(std::move(callMutatorAction));
+		if (needsTempVar)
+		{
+			propertyValuePtr = m_context->CreateTempVariable(property->GetType());
+		}
+		else
+		{
+			propertyValuePtr = property->GetValueAddress(value);
+		}
 
-					// Notify calling code that not all entities are resolved for this object
-					result.allEntitiesResolved = false;
-				}
+		// Read value
+		ReadResult propertyReadResult = ReadImpl(propertyType, propertyValuePtr, itemJsonVal);
+
+		if (propertyReadResult.Succeeded())
+		{
+			// We have succeeded, now call property mutator function to apply temp
+			property->CallMutator(value, const_cast<void*>(propertyValuePtr));
+
+			// As we already applied value to target, we can release temp variable
+			if (needsTempVar)
+			{
+				m_context->DestroyTempVariable(propertyValuePtr);
 			}
 		}
 		else
 		{
-			// If we couldn't find the property in json object, just log it, and produce no error
-			Log::LogMessage("Property '%s' not found in json object!", propertyName);
+			if (!propertyReadResult.allEntitiesResolved)
+			{
+				// If not all property value entities are resolved, make use of deferred commands list
+				auto callMutatorAction = std::make_unique<detail::CallObjectMutatorAction>(0, property, value, propertyValuePtr);
+				m_deferredCommandsList.push_back(std::move(callMutatorAction));
+
+				// Notify calling code that not all entities are resolved for this object
+				result.allEntitiesResolved = false;
+			}
 		}
 	}
 
+	m_propertyValues.resize(slotsBegin);
+
 	return result;
 }
 
@@ -386,23 +474,62 @@ ReadResult JsonReader::ReadCollection(const rttr::Type& type, void* value, const
 			// If we reach here, we have a valid collection
 			result.success = true;
 
+			// Contiguous collections of numbers are filled at once, skipping per item dispatch
+			if (collectionItemType.IsPlainNumeric() && type.IsContiguousCollection())
+			{
+				const std::size_t itemsCount = collectionItemsVal->size();
+				void* items = type.AppendCollectionItems(value, itemsCount);
+
+				if (nullptr != items)
+				{
+					if (ReadNumericItems(*collectionItemsVal, collectionItemType.GetNumericKind(), items))
+						return result;
+
+					type.RemoveCollectionItems(value, itemsCount);
+				}
+			}
+
+			type.ReserveCollection(value, collectionItemsVal->size());
+			inserter->SetReservedItemsCount(collectionItemsVal->size());
+
 			int i = 0;
 			for (const Json::Value& jsonItem : *collectionItemsVal)
 			{
-				Log::LogMessage("Reading collection item %d", i);
+				RS_LOG_TRACE("Reading collection item %d", i);
+
+				// Prefer reading straight into collection storage, it saves temp object and a copy per item
+				void* collectionItem = inserter->Emplace();
+				if (nullptr != collectionItem)
+				{
+					ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem, jsonItem);
+
+					if (!itemReadResult.allEntitiesResolved)
+					{
+						// Item stays in place, deferred actions will complete it
+						result.allEntitiesResolved = false;
+					}
+					else if (!itemReadResult.success)
+					{
+						RS_LOG_ERROR("Collection item failed to be read!");
+						inserter->CancelEmplace();
+					}
+
+					++i;
+					continue;
+				}
 
-				void* collectionItem = m_context->CreateTempVariable(collectionItemType);
+				collectionItem = m_context->CreateTempVariable(collectionItemType);
 				ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem, jsonItem);
 
 				if (itemReadResult.Succeeded())
 				{
 					// Item read successfully, so we can safely insert here and release item temp variable
-					inserter->Insert(collectionItem);
+					inserter->InsertMove(collectionItem);
 					m_context->DestroyTempVariable(collectionItem);
 				}
 				else
 				{
-					Log::LogMessage("Collection item failed to be read!");
+					RS_LOG_ERROR("Collection item failed to be read!");
 
 					if (!itemReadResult.allEntitiesResolved)
 					{
@@ -410,7 +537,7 @@ ReadResult JsonReader::ReadCollection(const rttr::Type& type, void* value, const
 						result.allEntitiesResolved = false;
 
 						// Not all entities of collection item are resolved, put insert command to deferred commands list
-						auto insertAction = std::make_unique<detail::CollectionInsertAction>(0, std::move(inserter), collectionItem);
+						auto insertAction = std::make_unique<detail::CollectionInsertAction>(0, type.CreateCollectionInserter(value), collectionItem);
 						m_deferredCommandsList.push_back(std::move(insertAction));
 					}
 					
@@ -438,7 +565,7 @@ ReadResult JsonReader::ReadPointer(const rttr::Type& type, void* value, const Js
 	else if (jsonVal.isUInt())
 	{
 		uint64_t objectId = jsonVal.asUInt64();
-		m_referencedContextObjects.emplace_back(objectId, type.GetPointedType());
+		EnqueueContextObject(objectId, type.GetPointedType());
 
 		result = ReadResult::OKResult();
 
@@ -478,7 +605,7 @@ ReadResult JsonReader::ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value
 	}
 	else
 	{
-		Log::LogMessage("Type has proxy type, but no read converter defined!");
+		RS_LOG_ERROR("Type has proxy type, but no read converter defined!");
 	}
 
 	return result;
@@ -502,12 +629,16 @@ ReadResult JsonReader::ReadArray(const rttr::Type& type, void* value, const Json
 			totalSize *= type.GetArrayExtent(i);
 		}
 
+		// Arrays of numbers are filled at once, skipping per item dispatch
+		if (arrayType.IsPlainNumeric() && jsonVal.size() <= totalSize && ReadNumericItems(jsonVal, arrayType.GetNumericKind(), value))
+			return result;
+
 		std::size_t i = 0U;
 		for (const Json::Value& arrayItemVal : jsonVal)
 		{
 			if (i >= totalSize)
 			{
-				Log::LogMessage("Actual json array doesn't fit in target array size!");
+				RS_LOG_WARNING("Actual json array doesn't fit in target array size!");
 				break;
 			}
 
@@ -535,11 +666,11 @@ ReadResult JsonReader::ReadImpl(const rttr::Type& type, void* value, const Json:
 
 	ReadResult result = ReadResult::GenericFailResult();
 
-	// Find in predefined types list
-	auto predefinedTypeIt = g_predefinedJsonTypeResolvers.find(type.GetTypeIndex());
-	if (predefinedTypeIt != g_predefinedJsonTypeResolvers.end())
+	// Predefined types are resolved with codec slot of the type
+	const rs::PredefinedType predefinedType = type.GetPredefinedType();
+	if (predefinedType != rs::PredefinedType::None)
 	{
-		predefinedTypeIt->second->Read(type, value, jsonVal);
+		g_predefinedJsonTypeResolvers[static_cast<std::size_t>(predefinedType)]->Read(type, value, jsonVal);
 		result = ReadResult::OKResult(); // Check errors from predefined types
 	}
 	else
@@ -550,7 +681,7 @@ ReadResult JsonReader::ReadImpl(const rttr::Type& type, void* value, const Json:
 		{
 			case rs::SerializationMethod::Proxy:
 			{
-				rttr::TypeProxyData* proxyTypeData = rttr::Manager::GetRTTRManager().GetProxyType(type);
+				rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
 				if (nullptr != proxyTypeData)
 				{
 					result = ReadProxy(proxyTypeData, value, jsonVal);
@@ -559,7 +690,7 @@ ReadResult JsonReader::ReadImpl(const rttr::Type& type, void* value, const Json:
 			break;
 			case rs::SerializationMethod::Adapter:
 			{
-				SerializationAdapter* adapter = rttr::Manager::GetRTTRManager().GetSerializationAdapter(type);
+				SerializationAdapter* adapter = type.GetSerializationAdapter();
 				if (nullptr != adapter)
 				{
 					// Parse payload
@@ -602,7 +733,7 @@ ReadResult JsonReader::ReadImpl(const rttr::Type& type, void* value, const Json:
 						const std::size_t propertiesCount = type.GetPropertiesCount();
 						if (propertiesCount > 0U)
 						{
-							ReadResult propertiesReadResult = ReadObjectProperties(type, value, jsonVal, propertiesCount);
+							ReadResult propertiesReadResult = ReadObjectProperties(type, value, jsonVal);
 							result.Merge(propertiesReadResult);
 						}
 						
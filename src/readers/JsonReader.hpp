@@ -1,5 +1,7 @@
 #pragma once
 #include "readers/BaseReader.hpp"
+#include "readers/InputSource.hpp"
+#include "readers/ObjectShapeCache.hpp"
 #include "rttr/Type.hpp"
 #include "actions/IReaderAction.hpp"
 #include "SerializationContext.hpp"
@@ -7,6 +9,7 @@
 
 #include <istream>
 #include <unordered_map>
+#include <vector>
 #include <json/json.h>
 
 namespace rs
@@ -24,6 +27,8 @@ public:
 	explicit RAVEN_SERIALIZE_API JsonReader(std::istream& stream);
 	explicit RAVEN_SERIALIZE_API JsonReader(Json::Value&& jsonVal);
 	explicit RAVEN_SERIALIZE_API JsonReader(const std::string& jsonContent);
+	// Parses directly from source memory, for example from MappedFileInputSource, without copying it
+	explicit RAVEN_SERIALIZE_API JsonReader(std::unique_ptr<InputSource>&& source);
 	RAVEN_SERIALIZE_API ~JsonReader() = default;
 
 	bool RAVEN_SERIALIZE_API IsOk() const final;
@@ -33,16 +38,20 @@ protected:
 	bool CheckSourceHasObjectsList() final;
 
 private:
+	void Parse(const char* begin, const char* end);
+
 	// Primary function to read any object type, will redirect to particular read method according to the type info
 	ReadResult ReadImpl(const rttr::Type& type, void* value, const Json::Value& jsonVal);
 
 	void ReadContextObject(const rttr::Type& type, void* value, const Json::Value& jsonVal);
-	Json::Value const* FindContextJsonObject(const Json::Value& jsonRoot, const uint64_t id) const;
+	// Builds id to json object index of context objects list, so every object lookup is O(1)
+	void IndexContextObjects(const Json::Value& contextObjectsVal);
+	Json::Value const* FindContextJsonObject(const uint64_t id) const;
 
 	// Read object value from json, like it was proxy type, using proxy read converted (copy constructor from proxy to target type, etc)
 	ReadResult ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value, const Json::Value& jsonVal);
-	// Read object named properties (like simple json object)
-	ReadResult ReadObjectProperties(const rttr::Type& type, void* value, const Json::Value& jsonVal, std::size_t propertiesCount);
+	// Read object named properties (like simple json object), properties are read in declaration order
+	ReadResult ReadObjectProperties(const rttr::Type& type, void* value, const Json::Value& jsonVal);
 	// Read collection part of object
 	// While object can contain collection traits, it can have other properties, that are serialized, except items
 	// When collection is simple array of items, and stored as json array - just read it
@@ -56,6 +65,10 @@ private:
 
 private:
 	Json::Value m_jsonRoot;
+	std::unordered_map<uint64_t, Json::Value const*> m_contextObjectsIndex;
+	detail::ObjectShapeCache m_shapeCache;
+	// Json members matched to properties of objects being read, slots of nested objects follow slots of their parents
+	std::vector<const Json::Value*> m_propertyValues;
 	bool m_isOk = false;
 };
 
@@ -0,0 +1,503 @@
+#include "readers/MsgPackParser.hpp"
+#include "rs/MsgPackFormat.hpp"
+
+#include <cstring>
+
+namespace
+{
+
+namespace msgpack = rs::detail::msgpack;
+
+// Real to integer conversion, values out of integer range are zeroed instead of being undefined
+template <typename IntT>
+IntT TruncateReal(const double value)
+{
+	constexpr double k_limit = 9223372036854775808.0; // 2^63
+	if (!(value > -k_limit && value < k_limit))
+		return IntT(0);
+
+	return static_cast<IntT>(static_cast<int64_t>(value));
+}
+
+double BitsToReal(const uint64_t bits, const bool isFloat)
+{
+	if (isFloat)
+	{
+		const uint32_t floatBits = static_cast<uint32_t>(bits);
+		float value;
+		std::memcpy(&value, &floatBits, sizeof(value));
+		return value;
+	}
+
+	double value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+}
+
+namespace rs
+{
+namespace detail
+{
+
+MsgPackParser::MsgPackParser(const char* begin, const char* end)
+	: m_begin(begin)
+	, m_cursor(begin)
+	, m_end(end)
+{}
+
+MsgPackType MsgPackParser::Peek() const
+{
+	if (m_hasError || m_cursor >= m_end)
+		return MsgPackType::Invalid;
+
+	const uint8_t marker = static_cast<uint8_t>(*m_cursor);
+
+	if (marker <= msgpack::k_positiveFixIntMax || marker >= msgpack::k_negativeFixIntMin)
+		return MsgPackType::Integer;
+	if (marker < msgpack::k_fixArray)
+		return MsgPackType::Map;
+	if (marker < msgpack::k_fixStr)
+		return MsgPackType::Array;
+	if (marker < msgpack::k_nil)
+		return MsgPackType::String;
+
+	switch (marker)
+	{
+	case msgpack::k_nil:
+		return MsgPackType::Nil;
+	case msgpack::k_false:
+	case msgpack::k_true:
+		return MsgPackType::Boolean;
+	case msgpack::k_bin8:
+	case msgpack::k_bin16:
+	case msgpack::k_bin32:
+		return MsgPackType::Binary;
+	case msgpack::k_float32:
+	case msgpack::k_float64:
+		return MsgPackType::Real;
+	case msgpack::k_uint8:
+	case msgpack::k_uint16:
+	case msgpack::k_uint32:
+	case msgpack::k_uint64:
+	case msgpack::k_int8:
+	case msgpack::k_int16:
+	case msgpack::k_int32:
+	case msgpack::k_int64:
+		return MsgPackType::Integer;
+	case msgpack::k_str8:
+	case msgpack::k_str16:
+	case msgpack::k_str32:
+		return MsgPackType::String;
+	case msgpack::k_array16:
+	case msgpack::k_array32:
+		return MsgPackType::Array;
+	case msgpack::k_map16:
+	case msgpack::k_map32:
+		return MsgPackType::Map;
+	default:
+		break;
+	}
+
+	if ((marker >= msgpack::k_ext8 && marker <= msgpack::k_ext32) || (marker >= msgpack::k_fixExt1 && marker <= msgpack::k_fixExt16))
+		return MsgPackType::Extension;
+
+	return MsgPackType::Invalid;
+}
+
+bool MsgPackParser::ReadNil()
+{
+	if (Peek() != MsgPackType::Nil)
+		return false;
+
+	++m_cursor;
+	return true;
+}
+
+bool MsgPackParser::ReadBool(bool& value)
+{
+	if (Peek() != MsgPackType::Boolean)
+		return false;
+
+	value = (static_cast<uint8_t>(*m_cursor++) == msgpack::k_true);
+	return true;
+}
+
+bool MsgPackParser::ReadNumber(NumberClass& numberClass, uint64_t& bits)
+{
+	const MsgPackType type = Peek();
+	if (type != MsgPackType::Integer && type != MsgPackType::Real)
+		return false;
+
+	const uint8_t marker = static_cast<uint8_t>(*m_cursor++);
+
+	if (marker <= msgpack::k_positiveFixIntMax)
+	{
+		numberClass = NumberClass::Unsigned;
+		bits = marker;
+		return true;
+	}
+
+	if (marker >= msgpack::k_negativeFixIntMin)
+	{
+		numberClass = NumberClass::Signed;
+		bits = static_cast<uint64_t>(static_cast<int64_t>(static_cast<int8_t>(marker)));
+		return true;
+	}
+
+	switch (marker)
+	{
+	case msgpack::k_float32:
+		numberClass = NumberClass::Float;
+		return ReadBigEndian(4U, bits);
+	case msgpack::k_float64:
+		numberClass = NumberClass::Double;
+		return ReadBigEndian(8U, bits);
+	case msgpack::k_uint8:
+	case msgpack::k_uint16:
+	case msgpack::k_uint32:
+	case msgpack::k_uint64:
+		numberClass = NumberClass::Unsigned;
+		return ReadBigEndian(std::size_t(1U) << (marker - msgpack::k_uint8), bits);
+	default:
+		break;
+	}
+
+	// Signed integers of 1, 2, 4 or 8 bytes, sign is extended to 64 bits
+	const std::size_t size = std::size_t(1U) << (marker - msgpack::k_int8);
+	if (!ReadBigEndian(size, bits))
+		return false;
+
+	if (size < 8U)
+	{
+		const unsigned shift = static_cast<unsigned>(64U - size * 8U);
+		bits = static_cast<uint64_t>(static_cast<int64_t>(bits << shift) >> shift);
+	}
+
+	numberClass = NumberClass::Signed;
+	return true;
+}
+
+bool MsgPackParser::ReadSigned(int64_t& value)
+{
+	NumberClass numberClass;
+	uint64_t bits = 0U;
+
+	if (!ReadNumber(numberClass, bits))
+		return false;
+
+	switch (numberClass)
+	{
+	case NumberClass::Float:
+	case NumberClass::Double:
+		value = TruncateReal<int64_t>(BitsToReal(bits, numberClass == NumberClass::Float));
+		break;
+	default:
+		value = static_cast<int64_t>(bits);
+		break;
+	}
+
+	return true;
+}
+
+bool MsgPackParser::ReadUnsigned(uint64_t& value)
+{
+	NumberClass numberClass;
+	uint64_t bits = 0U;
+
+	if (!ReadNumber(numberClass, bits))
+		return false;
+
+	switch (numberClass)
+	{
+	case NumberClass::Float:
+	case NumberClass::Double:
+		value = TruncateReal<uint64_t>(BitsToReal(bits, numberClass == NumberClass::Float));
+		break;
+	default:
+		value = bits;
+		break;
+	}
+
+	return true;
+}
+
+bool MsgPackParser::ReadReal(double& value)
+{
+	NumberClass numberClass;
+	uint64_t bits = 0U;
+
+	if (!ReadNumber(numberClass, bits))
+		return false;
+
+	switch (numberClass)
+	{
+	case NumberClass::Unsigned:
+		value = static_cast<double>(bits);
+		break;
+	case NumberClass::Signed:
+		value = static_cast<double>(static_cast<int64_t>(bits));
+		break;
+	default:
+		value = BitsToReal(bits, numberClass == NumberClass::Float);
+		break;
+	}
+
+	return true;
+}
+
+bool MsgPackParser::ReadString(std::string_view& value)
+{
+	if (Peek() != MsgPackType::String)
+		return false;
+
+	const uint8_t marker = static_cast<uint8_t>(*m_cursor);
+	if (marker < msgpack::k_nil)
+	{
+		// Length is stored in the marker byte
+		const std::size_t length = marker & msgpack::k_fixStrMaxLength;
+		++m_cursor;
+
+		if (static_cast<std::size_t>(m_end - m_cursor) < length)
+			return Fail();
+
+		value = std::string_view(m_cursor, length);
+		m_cursor += length;
+		return true;
+	}
+
+	++m_cursor;
+	return ReadPayload(std::size_t(1U) << (marker - msgpack::k_str8), 0U, value);
+}
+
+bool MsgPackParser::ReadBinary(std::string_view& value)
+{
+	if (Peek() != MsgPackType::Binary)
+		return false;
+
+	const uint8_t marker = static_cast<uint8_t>(*m_cursor++);
+	return ReadPayload(std::size_t(1U) << (marker - msgpack::k_bin8), 0U, value);
+}
+
+bool MsgPackParser::ReadArrayHeader(std::size_t& count)
+{
+	if (Peek() != MsgPackType::Array)
+		return false;
+
+	const uint8_t marker = static_cast<uint8_t>(*m_cursor++);
+	if (marker < msgpack::k_fixStr)
+	{
+		count = marker & msgpack::k_fixArrayMaxCount;
+	}
+	else if (!ReadLength(marker == msgpack::k_array16 ? 2U : 4U, count))
+	{
+		return false;
+	}
+
+	if (count > static_cast<std::size_t>(m_end - m_cursor))
+		return Fail();
+
+	return true;
+}
+
+bool MsgPackParser::ReadMapHeader(std::size_t& count)
+{
+	if (Peek() != MsgPackType::Map)
+		return false;
+
+	const uint8_t marker = static_cast<uint8_t>(*m_cursor++);
+	if (marker < msgpack::k_fixArray)
+	{
+		count = marker & msgpack::k_fixMapMaxCount;
+	}
+	else if (!ReadLength(marker == msgpack::k_map16 ? 2U : 4U, count))
+	{
+		return false;
+	}
+
+	// Every member is a key and a value, two bytes at least
+	if (count > static_cast<std::size_t>(m_end - m_cursor) / 2U)
+		return Fail();
+
+	return true;
+}
+
+bool MsgPackParser::SkipValue()
+{
+	// Containers only add to the count of values left to skip, so nesting depth doesn't matter
+	uint64_t valuesLeft = 1U;
+
+	while (valuesLeft > 0U)
+	{
+		--valuesLeft;
+
+		std::size_t count = 0U;
+		std::string_view payload;
+		NumberClass numberClass;
+		uint64_t bits = 0U;
+
+		switch (Peek())
+		{
+		case MsgPackType::Nil:
+		case MsgPackType::Boolean:
+			++m_cursor;
+			break;
+		case MsgPackType::Integer:
+		case MsgPackType::Real:
+			if (!ReadNumber(numberClass, bits))
+				return Fail();
+			break;
+		case MsgPackType::String:
+			if (!ReadString(payload))
+				return Fail();
+			break;
+		case MsgPackType::Binary:
+			if (!ReadBinary(payload))
+				return Fail();
+			break;
+		case MsgPackType::Extension:
+		{
+			const uint8_t marker = static_cast<uint8_t>(*m_cursor++);
+			const bool isFixExt = (marker >= msgpack::k_fixExt1);
+
+			if (isFixExt)
+			{
+				// Type byte and 1 to 16 data bytes
+				const std::size_t size = 1U + (std::size_t(1U) << (marker - msgpack::k_fixExt1));
+				if (static_cast<std::size_t>(m_end - m_cursor) < size)
+					return Fail();
+
+				m_cursor += size;
+			}
+			else if (!ReadPayload(std::size_t(1U) << (marker - msgpack::k_ext8), 1U, payload))
+			{
+				return Fail();
+			}
+		}
+		break;
+		case MsgPackType::Array:
+			if (!ReadArrayHeader(count))
+				return Fail();
+			valuesLeft += count;
+			break;
+		case MsgPackType::Map:
+			if (!ReadMapHeader(count))
+				return Fail();
+			valuesLeft += 2U * static_cast<uint64_t>(count);
+			break;
+		default:
+			return Fail();
+		}
+	}
+
+	return true;
+}
+
+const char* MsgPackParser::FindMemberValue(const char* mapStart, std::string_view key)
+{
+	const char* savedCursor = m_cursor;
+	const char* memberValue = nullptr;
+
+	m_cursor = mapStart;
+
+	std::size_t count = 0U;
+	if (ReadMapHeader(count))
+	{
+		for (std::size_t i = 0U; i < count && !m_hasError; ++i)
+		{
+			std::string_view memberKey;
+			if (ReadString(memberKey))
+			{
+				if (memberKey == key)
+				{
+					memberValue = m_cursor;
+					break;
+				}
+			}
+			else
+			{
+				SkipValue();
+			}
+
+			SkipValue();
+		}
+	}
+
+	m_cursor = savedCursor;
+	return memberValue;
+}
+
+const char* MsgPackParser::GetCursor() const
+{
+	return m_cursor;
+}
+
+void MsgPackParser::SetCursor(const char* cursor)
+{
+	m_cursor = cursor;
+}
+
+bool MsgPackParser::IsAtEnd() const
+{
+	return m_cursor >= m_end;
+}
+
+bool MsgPackParser::HasError() const
+{
+	return m_hasError;
+}
+
+std::size_t MsgPackParser::GetErrorOffset() const
+{
+	return static_cast<std::size_t>(m_cursor - m_begin);
+}
+
+bool MsgPackParser::ReadBigEndian(const std::size_t size, uint64_t& value)
+{
+	if (static_cast<std::size_t>(m_end - m_cursor) < size)
+		return Fail();
+
+	value = 0U;
+	for (std::size_t i = 0U; i < size; ++i)
+	{
+		value = (value << 8) | static_cast<uint8_t>(m_cursor[i]);
+	}
+
+	m_cursor += size;
+	return true;
+}
+
+bool MsgPackParser::ReadLength(const std::size_t lengthSize, std::size_t& length)
+{
+	uint64_t value = 0U;
+	if (!ReadBigEndian(lengthSize, value))
+		return false;
+
+	length = static_cast<std::size_t>(value);
+	return true;
+}
+
+bool MsgPackParser::ReadPayload(const std::size_t lengthSize, const std::size_t extraSize, std::string_view& payload)
+{
+	std::size_t length = 0U;
+	if (!ReadLength(lengthSize, length))
+		return false;
+
+	if (static_cast<std::size_t>(m_end - m_cursor) < extraSize || static_cast<std::size_t>(m_end - m_cursor) - extraSize < length)
+		return Fail();
+
+	m_cursor += extraSize;
+	payload = std::string_view(m_cursor, length);
+	m_cursor += length;
+	return true;
+}
+
+bool MsgPackParser::Fail()
+{
+	m_hasError = true;
+	return false;
+}
+
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,95 @@
+#pragma once
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace rs
+{
+namespace detail
+{
+
+enum class MsgPackType
+{
+	Invalid,
+	Nil,
+	Boolean,
+	Integer,
+	Real,
+	String,
+	Binary,
+	Array,
+	Map,
+	Extension,
+};
+
+/*
+* @brief Pull parser over contiguous MessagePack data
+*
+* Same idea as JsonPullParser: no document is built, values are decoded on demand, strings and binaries are views
+* into the source buffer. Containers are length prefixed, so array and map headers return items count,
+* and caller consumes exactly that many values (or key/value pairs) afterwards.
+*/
+class MsgPackParser
+{
+public:
+	MsgPackParser() = default;
+	MsgPackParser(const char* begin, const char* end);
+
+	// Returns the type of next value without consuming it
+	MsgPackType Peek() const;
+
+	bool ReadNil();
+	bool ReadBool(bool& value);
+	// Integers are converted the same way json readers do: out of range values wrap, reals are truncated
+	bool ReadSigned(int64_t& value);
+	bool ReadUnsigned(uint64_t& value);
+	// Reads real or integer value
+	bool ReadReal(double& value);
+	bool ReadString(std::string_view& value);
+	bool ReadBinary(std::string_view& value);
+
+	// Container headers, count is checked against remaining data size, as every value takes one byte at least
+	bool ReadArrayHeader(std::size_t& count);
+	bool ReadMapHeader(std::size_t& count);
+
+	// Skips the next value of any kind, nested containers are skipped without recursion
+	bool SkipValue();
+
+	// Looks for the string key in the map starting at mapStart, doesn't move the cursor
+	// Returns member value position, or nullptr if map has no such key
+	const char* FindMemberValue(const char* mapStart, std::string_view key);
+
+	const char* GetCursor() const;
+	// Cursor can only be restored to the position of some value start
+	void SetCursor(const char* cursor);
+
+	bool IsAtEnd() const;
+	bool HasError() const;
+	std::size_t GetErrorOffset() const;
+
+private:
+	enum class NumberClass
+	{
+		Unsigned,
+		Signed,
+		Float,
+		Double,
+	};
+
+	// Consumes any integer or real value, bits are zero or sign extended integer, or raw bits of float or double
+	bool ReadNumber(NumberClass& numberClass, uint64_t& bits);
+	bool ReadBigEndian(const std::size_t size, uint64_t& value);
+	bool ReadLength(const std::size_t lengthSize, std::size_t& length);
+	// Reads header of string, binary or extension value and returns its payload
+	bool ReadPayload(const std::size_t lengthSize, const std::size_t extraSize, std::string_view& payload);
+	bool Fail();
+
+private:
+	const char* m_begin = nullptr;
+	const char* m_cursor = nullptr;
+	const char* m_end = nullptr;
+	bool m_hasError = false;
+};
+
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,919 @@
+#include "readers/MsgPackReader.hpp"
+#include "rttr/Property.hpp"
+#include "rttr/Manager.hpp"
+#include "rs/SerializationKeywords.hpp"
+#include "actions/CallObjectMutatorAction.hpp"
+#include "actions/ResolvePointerAction.hpp"
+#include "actions/CollectionInsertAction.hpp"
+
+namespace
+{
+
+// Reads single number into value of exact type, with the same conversions json readers do
+template <typename T>
+bool ReadNumber(rs::detail::MsgPackParser& parser, T& value)
+{
+	if constexpr (std::is_same_v<T, bool>)
+	{
+		switch (parser.Peek())
+		{
+		case rs::detail::MsgPackType::Boolean:
+			return parser.ReadBool(value);
+		case rs::detail::MsgPackType::Nil:
+			value = false;
+			return parser.ReadNil();
+		default:
+		{
+			uint64_t intValue = 0U;
+			if (!parser.ReadUnsigned(intValue))
+				return false;
+
+			value = !!intValue;
+			return true;
+		}
+		}
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		double realValue = 0.0;
+		if (!parser.ReadReal(realValue))
+			return false;
+
+		value = static_cast<T>(realValue);
+		return true;
+	}
+	else if constexpr (std::is_signed_v<T>)
+	{
+		int64_t intValue = 0;
+		if (!parser.ReadSigned(intValue))
+			return false;
+
+		value = static_cast<T>(intValue);
+		return true;
+	}
+	else
+	{
+		uint64_t intValue = 0U;
+		if (!parser.ReadUnsigned(intValue))
+			return false;
+
+		value = static_cast<T>(intValue);
+		return true;
+	}
+}
+
+}
+
+namespace rs
+{
+
+MsgPackReader::MsgPackReader(std::istream& stream)
+{
+	std::size_t startOffset = stream.tellg();
+
+	stream.seekg(0, std::ios::end);
+	std::size_t bufferSize = static_cast<std::size_t>(stream.tellg()) - startOffset;
+	stream.seekg(startOffset, std::ios::beg);
+
+	if (bufferSize > 0U)
+	{
+		std::string buffer(bufferSize, '\0');
+		stream.read(&buffer[0], bufferSize);
+		buffer.resize(static_cast<std::size_t>(stream.gcount()));
+
+		m_source = std::make_unique<MemoryInputSource>(std::move(buffer));
+		InitParser();
+	}
+
+	if (!m_isOk)
+	{
+		// Revert stream back to original offset
+		stream.clear();
+		stream.seekg(startOffset, std::ios::beg);
+	}
+}
+
+MsgPackReader::MsgPackReader(std::string content)
+	: m_source(std::make_unique<MemoryInputSource>(std::move(content)))
+{
+	InitParser();
+}
+
+MsgPackReader::MsgPackReader(std::unique_ptr<InputSource>&& source)
+	: m_source(std::move(source))
+{
+	InitParser();
+}
+
+void MsgPackReader::InitParser()
+{
+	if (m_source && m_source->IsOk())
+	{
+		m_parser = detail::MsgPackParser(m_source->GetData(), m_source->GetData() + m_source->GetSize());
+		m_isOk = (m_parser.Peek() != detail::MsgPackType::Invalid);
+	}
+}
+
+bool MsgPackReader::IndexContextObjects(uint64_t& masterObjectId)
+{
+	const char* rootPosition = m_parser.GetCursor();
+	const char* contextObjectsPosition = nullptr;
+	bool hasMasterObjectId = false;
+
+	std::size_t membersCount = 0U;
+	if (m_parser.ReadMapHeader(membersCount))
+	{
+		// Objects list documents have only master object id and objects list members, so stop at the first other member
+		for (std::size_t i = 0U; i < membersCount; ++i)
+		{
+			std::string_view key;
+			if (!m_parser.ReadString(key))
+				break;
+
+			if (key == K_MASTER_OBJ_ID && m_parser.Peek() == detail::MsgPackType::Integer)
+			{
+				hasMasterObjectId = m_parser.ReadUnsigned(masterObjectId);
+			}
+			else if (key == K_CONTEXT_OBJECTS && m_parser.Peek() == detail::MsgPackType::Array)
+			{
+				contextObjectsPosition = m_parser.GetCursor();
+				m_parser.SkipValue();
+			}
+			else if (hasMasterObjectId || nullptr != contextObjectsPosition)
+			{
+				m_parser.SkipValue();
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+
+	const bool hasObjectsList = hasMasterObjectId && nullptr != contextObjectsPosition && !m_parser.HasError();
+	if (hasObjectsList)
+	{
+		// Index objects list, only ids are parsed here, object values are skipped
+		m_parser.SetCursor(contextObjectsPosition);
+
+		std::size_t objectsCount = 0U;
+		m_parser.ReadArrayHeader(objectsCount);
+
+		for (std::size_t i = 0U; i < objectsCount && !m_parser.HasError(); ++i)
+		{
+			std::size_t objectMembersCount = 0U;
+			if (!m_parser.ReadMapHeader(objectMembersCount))
+			{
+				m_parser.SkipValue();
+				continue;
+			}
+
+			uint64_t objectId = 0U;
+			bool hasId = false;
+			const char* objectValuePosition = nullptr;
+
+			for (std::size_t memberIdx = 0U; memberIdx < objectMembersCount; ++memberIdx)
+			{
+				std::string_view key;
+				if (!m_parser.ReadString(key))
+				{
+					m_parser.SkipValue();
+				}
+				else if (key == K_CONTEXT_OBJ_ID && m_parser.Peek() == detail::MsgPackType::Integer)
+				{
+					hasId = m_parser.ReadUnsigned(objectId);
+					continue;
+				}
+				else if (key == K_CONTEXT_OBJ_VAL)
+				{
+					objectValuePosition = m_parser.GetCursor();
+				}
+
+				m_parser.SkipValue();
+			}
+
+			if (hasId && nullptr != objectValuePosition)
+			{
+				m_contextObjectsIndex.emplace(objectId, objectValuePosition);
+			}
+		}
+	}
+
+	m_parser.SetCursor(rootPosition);
+
+	return hasObjectsList && !m_parser.HasError();
+}
+
+void MsgPackReader::ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const char* objectValuePosition)
+{
+	m_parser.SetCursor(objectValuePosition);
+	ReadResult objectReadResult = ReadImpl(type, value);
+
+	if (objectReadResult.success)
+	{
+		m_context->AddObject(objectId, type, value);
+	}
+	else
+	{
+		RS_LOG_ERROR("Failed to read context object!");
+	}
+}
+
+void MsgPackReader::DoRead(const rttr::Type& type, void* value)
+{
+	uint64_t masterObjectId = 0U;
+	m_hasObjectsList = IndexContextObjects(masterObjectId);
+
+	if (m_hasObjectsList)
+	{
+		auto masterObjectIt = m_contextObjectsIndex.find(masterObjectId);
+		if (masterObjectIt != m_contextObjectsIndex.end())
+		{
+			// Parse master object, it's marked as visited first, so references to it are not queued
+			MarkContextObjectVisited(masterObjectId);
+			ReadContextObject(type, value, masterObjectId, masterObjectIt->second);
+
+			// Handle referenced context objects, each of them is queued only once, so every object is loaded exactly one time
+			std::pair<uint64_t, rttr::Type> objectReference;
+			while (PopPendingContextObject(objectReference))
+			{
+				bool contextObjectValid = false;
+
+				auto contextObjectIt = m_contextObjectsIndex.find(objectReference.first);
+				if (contextObjectIt != m_contextObjectsIndex.end())
+				{
+					rttr::Type pointedType = objectReference.second;
+
+					if (pointedType.IsValid())
+					{
+						// Check actual type of polymorphic type
+						if (pointedType.IsPolymorphic())
+						{
+							const char* typeIdPosition = m_parser.FindMemberValue(contextObjectIt->second, K_TYPE_ID);
+							if (nullptr != typeIdPosition)
+							{
+								std::string_view typeName;
+								m_parser.SetCursor(typeIdPosition);
+
+								if (m_parser.ReadString(typeName))
+								{
+									rttr::Type deducedType = rttr::Reflect(std::string(typeName).c_str());
+									if (deducedType.IsValid() && deducedType.IsBaseClass(pointedType))
+									{
+										pointedType = deducedType;
+									}
+								}
+							}
+						}
+
+						void* pointedValue = pointedType.Instantiate();
+						if (nullptr != pointedValue)
+						{
+							ReadContextObject(pointedType, pointedValue, objectReference.first, contextObjectIt->second);
+							contextObjectValid = true;
+						}
+					}
+				}
+
+				if (!contextObjectValid)
+				{
+					m_context->AddObject(objectReference.first, objectReference.second, nullptr);
+				}
+			}
+		}
+		else
+		{
+			RS_LOG_ERROR("Master object not found in the context objects list!");
+		}
+	}
+	else
+	{
+		// We have single object, simply read it here
+		ReadImpl(type, value);
+	}
+
+	if (m_parser.HasError())
+	{
+		RS_LOG_ERROR("MessagePack parse error at offset %llu!", static_cast<unsigned long long>(m_parser.GetErrorOffset()));
+	}
+}
+
+bool MsgPackReader::CheckSourceHasObjectsList()
+{
+	return m_hasObjectsList;
+}
+
+ReadResult MsgPackReader::SkipMismatchedValue()
+{
+	m_parser.SkipValue();
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult MsgPackReader::ReadObjectBases(const rttr::Type& type, void* value)
+{
+	std::size_t basesCount = 0U;
+	if (!m_parser.ReadArrayHeader(basesCount))
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::OKResult();
+	const auto& baseClassesInfo = type.GetBaseClasses();
+
+	for (std::size_t baseIdx = 0U; baseIdx < basesCount && !m_parser.HasError(); ++baseIdx)
+	{
+		const char* baseValuePosition = m_parser.GetCursor();
+		bool baseClassResolved = false;
+
+		if (m_parser.Peek() == detail::MsgPackType::Map)
+		{
+			// Lookup base class name first, then read the base part from the same map
+			const char* baseIdPosition = m_parser.FindMemberValue(baseValuePosition, K_BASE_ID);
+			if (nullptr != baseIdPosition)
+			{
+				std::string_view baseName;
+				m_parser.SetCursor(baseIdPosition);
+				m_parser.ReadString(baseName);
+
+				for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+				{
+					rttr::Type baseClass = baseClassesInfo.first[i];
+					if (baseName == baseClass.GetName())
+					{
+						m_parser.SetCursor(baseValuePosition);
+						ReadResult baseReadResult = ReadImpl(baseClass, value);
+						result.Merge(baseReadResult);
+
+						baseClassResolved = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (!baseClassResolved)
+		{
+			RS_LOG_ERROR("Base class of '%s' not resolved!", type.GetName());
+
+			m_parser.SetCursor(baseValuePosition);
+			m_parser.SkipValue();
+		}
+	}
+
+	return result;
+}
+
+ReadResult MsgPackReader::ReadObjectProperties(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::OKResult(); // If we have no properties, it's OK
+
+	const bool isCollection = type.IsCollection();
+
+	// Members are resolved using shape of the previous object of this type, so homogeneous objects cost one key comparison per member
+	detail::ObjectShapeCache::Shape& shape = m_shapeCache.GetShape(type);
+
+	std::size_t membersCount = 0U;
+	m_parser.ReadMapHeader(membersCount);
+
+	for (std::size_t memberPosition = 0U; memberPosition < membersCount && !m_parser.HasError(); ++memberPosition)
+	{
+		std::string_view key;
+		if (!m_parser.ReadString(key))
+		{
+			// Only string keys can match properties
+			m_parser.SkipValue();
+			m_parser.SkipValue();
+			continue;
+		}
+
+		const std::size_t propertyIdx = shape.Resolve(type, memberPosition, key);
+		if (propertyIdx == rttr::k_invalidPropertyIndex)
+		{
+			if (key == K_BASES)
+			{
+				ReadResult basesReadResult = ReadObjectBases(type, value);
+				result.Merge(basesReadResult);
+			}
+			else if (isCollection && key == K_COLLECTION_ITEMS)
+			{
+				ReadResult collectionReadResult = ReadCollection(type, value);
+				result.Merge(collectionReadResult);
+			}
+			else
+			{
+				// If we couldn't find the property for map member, just skip it, and produce no error
+				m_parser.SkipValue();
+			}
+
+			continue;
+		}
+
+		rttr::Property* property = type.GetProperty(propertyIdx);
+		const rttr::Type& propertyType = property->GetType();
+
+		RS_LOG_TRACE("Reading property '%s::%s'", type.GetName(), property->GetName());
+
+		// Decide to create temp variable or not
+		void* propertyValuePtr = nullptr;
+		bool needsTempVar = property->NeedsTempVariable();
+
+		if (needsTempVar)
+		{
+			propertyValuePtr = m_context->CreateTempVariable(propertyType);
+		}
+		else
+		{
+			propertyValuePtr = property->GetValueAddress(value);
+		}
+
+		// Read value
+		ReadResult propertyReadResult = ReadImpl(propertyType, propertyValuePtr);
+
+		if (propertyReadResult.Succeeded())
+		{
+			// We have succeeded, now call property mutator function to apply temp
+			property->CallMutator(value, propertyValuePtr);
+
+			// As we already applied value to target, we can release temp variable
+			if (needsTempVar)
+			{
+				m_context->DestroyTempVariable(propertyValuePtr);
+			}
+		}
+		else
+		{
+			if (!propertyReadResult.allEntitiesResolved)
+			{
+				// If not all property value entities are resolved, make use of deferred commands list
+				auto callMutatorAction = std::make_unique<detail::CallObjectMutatorAction>(0, property, value, propertyValuePtr);
+				m_deferredCommandsList.push_back(std::move(callMutatorAction));
+
+				// Notify calling code that not all entities are resolved for this object
+				result.allEntitiesResolved = false;
+			}
+		}
+	}
+
+	return result;
+}
+
+ReadResult MsgPackReader::ReadCollection(const rttr::Type& type, void* value)
+{
+	if (m_parser.Peek() != detail::MsgPackType::Array)
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::GenericFailResult();
+
+	// We have correct value with items data, now get collection traits from meta type
+	std::unique_ptr<rttr::CollectionInserterBase> inserter = type.CreateCollectionInserter(value);
+	rttr::Type collectionItemType = type.GetCollectionItemType();
+
+	if (!inserter || !collectionItemType.IsValid())
+		return SkipMismatchedValue();
+
+	// If we reach here, we have a valid collection
+	result.success = true;
+
+	const char* arrayStart = m_parser.GetCursor();
+
+	// Items count is stored in array header, so no lookahead is needed
+	std::size_t itemsCount = 0U;
+	if (!m_parser.ReadArrayHeader(itemsCount))
+		return ReadResult::GenericFailResult();
+
+	// Contiguous collections of numbers are filled at once, skipping per item dispatch
+	if (collectionItemType.IsPlainNumeric() && type.IsContiguousCollection())
+	{
+		void* items = type.AppendCollectionItems(value, itemsCount);
+		if (nullptr != items)
+		{
+			if (ReadNumericItems(collectionItemType.GetNumericKind(), items, itemsCount))
+				return result;
+
+			// Roll back and read items one by one
+			type.RemoveCollectionItems(value, itemsCount);
+			m_parser.SetCursor(arrayStart);
+			m_parser.ReadArrayHeader(itemsCount);
+		}
+	}
+
+	type.ReserveCollection(value, itemsCount);
+	inserter->SetReservedItemsCount(itemsCount);
+
+	for (std::size_t i = 0U; i < itemsCount && !m_parser.HasError(); ++i)
+	{
+		RS_LOG_TRACE("Reading collection item %llu", static_cast<unsigned long long>(i));
+
+		// Prefer reading straight into collection storage, it saves temp object and a copy per item
+		void* collectionItem = inserter->Emplace();
+		if (nullptr != collectionItem)
+		{
+			ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem);
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Item stays in place, deferred actions will complete it
+				result.allEntitiesResolved = false;
+			}
+			else if (!itemReadResult.success)
+			{
+				RS_LOG_ERROR("Collection item failed to be read!");
+				inserter->CancelEmplace();
+			}
+
+			continue;
+		}
+
+		collectionItem = m_context->CreateTempVariable(collectionItemType);
+		ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem);
+
+		if (itemReadResult.Succeeded())
+		{
+			// Item read successfully, so we can safely insert here and release item temp variable
+			inserter->InsertMove(collectionItem);
+			m_context->DestroyTempVariable(collectionItem);
+		}
+		else
+		{
+			RS_LOG_ERROR("Collection item failed to be read!");
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Notify caller that not all entities are resolved, and we must now defer actions using commands list
+				result.allEntitiesResolved = false;
+
+				// Not all entities of collection item are resolved, put insert command to deferred commands list
+				auto insertAction = std::make_unique<detail::CollectionInsertAction>(0, type.CreateCollectionInserter(value), collectionItem);
+				m_deferredCommandsList.push_back(std::move(insertAction));
+			}
+
+			// For other error cases, we just skip the item and don't add it to final collection
+		}
+	}
+
+	return result;
+}
+
+ReadResult MsgPackReader::ReadPointer(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+
+	switch (m_parser.Peek())
+	{
+		case detail::MsgPackType::Nil:
+		{
+			// Resolve null pointer
+			m_parser.ReadNil();
+			rttr::AssignPointerValue(value, nullptr);
+			result = ReadResult::OKResult();
+		}
+		break;
+		case detail::MsgPackType::Integer:
+		{
+			uint64_t objectId = 0U;
+			if (!m_parser.ReadUnsigned(objectId))
+				break;
+
+			EnqueueContextObject(objectId, type.GetPointedType());
+
+			result = ReadResult::OKResult();
+
+			// If we have resolved pointer address right now, use it
+			auto referencedObjectData = m_context->GetObjectById(objectId);
+			if (nullptr != referencedObjectData)
+			{
+				rttr::AssignPointerValue(value, referencedObjectData->objectPtr);
+			}
+			else
+			{
+				// Pointer can't be resolved right now, so put resolve action into deferred commands list
+				auto resolvePtrAction = std::make_unique<detail::ResolvePointerAction>(0, m_context.get(), value, objectId);
+				m_deferredCommandsList.push_back(std::move(resolvePtrAction));
+
+				result.allEntitiesResolved = false;
+			}
+		}
+		break;
+		default:
+			result = SkipMismatchedValue();
+			break;
+	}
+
+	return result;
+}
+
+ReadResult MsgPackReader::ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+
+	if (proxyTypeData->readConverter)
+	{
+		// Create proxy object
+		void* proxyObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+
+		// Read proxy object
+		result = ReadImpl(proxyTypeData->proxyType, proxyObject);
+
+		// Create target object using proxy constructor
+		proxyTypeData->readConverter->Convert(value, proxyObject);
+	}
+	else
+	{
+		RS_LOG_ERROR("Type has proxy type, but no read converter defined!");
+		m_parser.SkipValue();
+	}
+
+	return result;
+}
+
+ReadResult MsgPackReader::ReadAdapter(rs::SerializationAdapter* adapter, void* value)
+{
+	const char* valuePosition = m_parser.GetCursor();
+
+	auto readPayload = [&](SerializationAdapter::DataChunk& payload)
+	{
+		if (!payload.type.IsValid() || m_parser.Peek() != detail::MsgPackType::Map)
+			return ReadResult::OKResult();
+
+		// If it's a map with adapter member, treat it as payload
+		const char* payloadPosition = m_parser.FindMemberValue(valuePosition, K_ADAPTER);
+		if (nullptr == payloadPosition)
+			return ReadResult::OKResult();
+
+		payload.value = m_context->CreateTempVariable(payload.type);
+
+		m_parser.SetCursor(payloadPosition);
+		return ReadImpl(payload.type, payload.value);
+	};
+
+	auto readValue = [&](const rttr::Type& type, void* adapterValue)
+	{
+		// Read value as converted type, payload member will be skipped as unknown property
+		m_parser.SetCursor(valuePosition);
+
+		if (nullptr == adapterValue)
+		{
+			m_parser.SkipValue();
+			return ReadResult::GenericFailResult();
+		}
+
+		return ReadImpl(type, adapterValue);
+	};
+
+	return ReadAdapterData(adapter, value, readPayload, readValue);
+}
+
+ReadResult MsgPackReader::ReadArray(const rttr::Type& type, void* value)
+{
+	const char* arrayStart = m_parser.GetCursor();
+
+	std::size_t itemsCount = 0U;
+	if (!m_parser.ReadArrayHeader(itemsCount))
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::OKResult();
+
+	rttr::Type arrayType = type.GetArrayType();
+	uint8_t* arrayBytePtr = static_cast<uint8_t*>(value);
+	std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	// Arrays of numbers are filled at once, skipping per item dispatch
+	if (arrayType.IsPlainNumeric() && itemsCount <= totalSize)
+	{
+		if (ReadNumericItems(arrayType.GetNumericKind(), value, itemsCount))
+			return result;
+
+		// Roll back and read items one by one
+		m_parser.SetCursor(arrayStart);
+		m_parser.ReadArrayHeader(itemsCount);
+	}
+
+	if (itemsCount > totalSize)
+	{
+		RS_LOG_WARNING("Actual array doesn't fit in target array size!");
+	}
+
+	for (std::size_t i = 0U; i < itemsCount && !m_parser.HasError(); ++i)
+	{
+		if (i >= totalSize)
+		{
+			// Remaining items still have to be consumed to keep parser in sync
+			m_parser.SkipValue();
+			continue;
+		}
+
+		uint8_t* itemPtr = arrayBytePtr + itemSize * i;
+		ReadResult itemResult = ReadImpl(arrayType, itemPtr);
+
+		if (!itemResult.Succeeded())
+		{
+			if (!itemResult.allEntitiesResolved)
+			{
+				result.allEntitiesResolved = false;
+			}
+		}
+	}
+
+	return result;
+}
+
+bool MsgPackReader::ReadNumericItems(const rttr::NumericKind kind, void* items, const std::size_t count)
+{
+	return rttr::VisitNumericKind(kind, [this, items, count](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+
+		T* typedItems = static_cast<T*>(items);
+		for (std::size_t i = 0U; i < count; ++i)
+		{
+			if (!::ReadNumber(m_parser, typedItems[i]))
+				return false;
+		}
+
+		return true;
+	});
+}
+
+ReadResult MsgPackReader::ReadNumber(const rttr::Type& type, void* value)
+{
+	const bool isRead = rttr::VisitNumericKind(type.GetNumericKind(), [this, value](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+		return ::ReadNumber(m_parser, *static_cast<T*>(value));
+	});
+
+	return isRead ? ReadResult::OKResult() : SkipMismatchedValue();
+}
+
+ReadResult MsgPackReader::ReadStdString(void* value)
+{
+	switch (m_parser.Peek())
+	{
+		case detail::MsgPackType::Nil:
+		{
+			m_parser.ReadNil();
+			*static_cast<std::string*>(value) = std::string();
+			return ReadResult::OKResult();
+		}
+		case detail::MsgPackType::String:
+		{
+			std::string_view str;
+			if (m_parser.ReadString(str))
+			{
+				static_cast<std::string*>(value)->assign(str.data(), str.size());
+				return ReadResult::OKResult();
+			}
+		}
+		break;
+		default:
+			return SkipMismatchedValue();
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult MsgPackReader::ReadCString(void* value)
+{
+	char** strSerializedValue = reinterpret_cast<char**>(value);
+
+	switch (m_parser.Peek())
+	{
+		case detail::MsgPackType::Nil:
+		{
+			m_parser.ReadNil();
+			*strSerializedValue = nullptr;
+			return ReadResult::OKResult();
+		}
+		case detail::MsgPackType::String:
+		{
+			std::string_view str;
+			if (m_parser.ReadString(str))
+			{
+				const std::string& storedStr = m_cStringsStorage.emplace_back(str);
+				*strSerializedValue = const_cast<char*>(storedStr.c_str());
+				return ReadResult::OKResult();
+			}
+		}
+		break;
+		default:
+			return SkipMismatchedValue();
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult MsgPackReader::ReadImpl(const rttr::Type& type, void* value)
+{
+	assert(m_isOk);
+
+	// Predefined types are resolved with codec slot of the type
+	switch (type.GetPredefinedType())
+	{
+		case rs::PredefinedType::StdString:
+			return ReadStdString(value);
+		case rs::PredefinedType::CString:
+			return ReadCString(value);
+		default:
+			break;
+	}
+
+	ReadResult result = ReadResult::GenericFailResult();
+	rs::SerializationMethod serializationMethod = type.GetSerializationMethod();
+
+	switch (serializationMethod)
+	{
+		case rs::SerializationMethod::Proxy:
+		{
+			rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+			if (nullptr != proxyTypeData)
+			{
+				result = ReadProxy(proxyTypeData, value);
+			}
+			else
+			{
+				m_parser.SkipValue();
+			}
+		}
+		break;
+		case rs::SerializationMethod::Adapter:
+		{
+			SerializationAdapter* adapter = type.GetSerializationAdapter();
+			if (nullptr != adapter)
+			{
+				result = ReadAdapter(adapter, value);
+			}
+			else
+			{
+				m_parser.SkipValue();
+			}
+		}
+		break;
+		default:
+		{
+			switch (type.GetTypeClass())
+			{
+				case rttr::TypeClass::Object:
+				{
+					const detail::MsgPackType valueType = m_parser.Peek();
+
+					if (valueType == detail::MsgPackType::Map)
+					{
+						// Bases, properties and collection items are all read in a single pass over map members
+						result = ReadObjectProperties(type, value);
+					}
+					else if (valueType == detail::MsgPackType::Array && type.IsCollection() && type.GetPropertiesCount() == 0U)
+					{
+						// If this type has no properties, and written as array, use it as items container
+						result = ReadCollection(type, value);
+					}
+					else
+					{
+						result = SkipMismatchedValue();
+					}
+				}
+				break;
+				case rttr::TypeClass::Pointer:
+				{
+					result = ReadPointer(type, value);
+				}
+				break;
+				case rttr::TypeClass::Enum:
+				{
+					rttr::Type enumUnderlyingType = type.GetEnumUnderlyingType();
+					result = ReadImpl(enumUnderlyingType, value);
+				}
+				break;
+				case rttr::TypeClass::Real:
+				case rttr::TypeClass::Integral:
+				{
+					result = ReadNumber(type, value);
+				}
+				break;
+				case rttr::TypeClass::Array:
+				{
+					result = ReadArray(type, value);
+				}
+				break;
+				default:
+				{
+					result = SkipMismatchedValue();
+				}
+				break;
+			}
+		}
+		break;
+	}
+
+	return result;
+}
+
+bool MsgPackReader::IsOk() const
+{
+	return m_isOk;
+}
+
+} // namespace rs
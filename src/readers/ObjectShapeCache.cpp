@@ -0,0 +1,41 @@
+#include "readers/ObjectShapeCache.hpp"
+
+namespace rs
+{
+namespace detail
+{
+
+std::size_t ObjectShapeCache::Shape::Resolve(const rttr::Type& type, const std::size_t memberPosition, std::string_view key)
+{
+	if (memberPosition < m_entries.size())
+	{
+		Entry& entry = m_entries[memberPosition];
+		if (entry.key == key)
+		{
+			return entry.propertyIdx;
+		}
+
+		// Shape differs at this position, resolve by name and remember the new key
+		entry.key.assign(key.data(), key.size());
+		entry.propertyIdx = type.FindPropertyIndex(key);
+		return entry.propertyIdx;
+	}
+
+	const std::size_t propertyIdx = type.FindPropertyIndex(key);
+	m_entries.push_back(Entry{ std::string(key), propertyIdx });
+
+	return propertyIdx;
+}
+
+ObjectShapeCache::Shape& ObjectShapeCache::GetShape(const rttr::Type& type)
+{
+	return m_shapes[type];
+}
+
+void ObjectShapeCache::Clear()
+{
+	m_shapes.clear();
+}
+
+} // namespace detail
+} // namespace rs
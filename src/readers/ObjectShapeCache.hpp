@@ -0,0 +1,48 @@
+#pragma once
+#include "rttr/Type.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+
+namespace rs
+{
+namespace detail
+{
+
+/*
+* @brief Hidden class style cache of object member layouts
+*
+* Objects of the same type (for example items of homogeneous collections) usually have the same members in the same order.
+* For every type cache remembers member keys sequence of the last read object along with resolved property indices,
+* so member of the next object is resolved with a single key comparison, and full lookup happens only when shape differs.
+*/
+class ObjectShapeCache
+{
+public:
+	class Shape
+	{
+	public:
+		// Returns index of property for member at given position of the object, or k_invalidPropertyIndex
+		std::size_t Resolve(const rttr::Type& type, const std::size_t memberPosition, std::string_view key);
+
+	private:
+		struct Entry
+		{
+			std::string key;
+			std::size_t propertyIdx;
+		};
+
+		std::vector<Entry> m_entries;
+	};
+
+	Shape& GetShape(const rttr::Type& type);
+	void Clear();
+
+private:
+	std::unordered_map<rttr::Type, Shape> m_shapes;
+};
+
+} // namespace detail
+} // namespace rs
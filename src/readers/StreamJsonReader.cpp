@@ -0,0 +1,1044 @@
+#include "readers/StreamJsonReader.hpp"
+#include "rttr/Property.hpp"
+#include "rttr/Manager.hpp"
+#include "rs/SerializationKeywords.hpp"
+#include "actions/CallObjectMutatorAction.hpp"
+#include "actions/ResolvePointerAction.hpp"
+#include "actions/CollectionInsertAction.hpp"
+#include "rs/NumberFormat.hpp"
+
+namespace
+{
+
+// Parses number token straight into the value of destination type
+template <typename T>
+bool ParseToken(std::string_view token, const bool isInteger, T& value)
+{
+	return rs::detail::ParseNumber(token.data(), token.data() + token.size(), isInteger, value);
+}
+
+// Reads whole json array of numbers into contiguous items storage, fails on any item needing generic handling
+template <typename T>
+bool ReadNumericItems(rs::detail::JsonPullParser& parser, T* items, const std::size_t maxCount)
+{
+	if (!parser.BeginArray())
+		return false;
+
+	std::size_t i = 0U;
+	while (parser.NextItem())
+	{
+		if (i >= maxCount)
+			return false;
+
+		const rs::detail::JsonTokenType tokenType = parser.Peek();
+		std::string_view token;
+		bool isInteger = false;
+
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			if (tokenType == rs::detail::JsonTokenType::Boolean)
+			{
+				if (!parser.ReadBool(items[i]))
+					return false;
+			}
+			else if (tokenType == rs::detail::JsonTokenType::Null)
+			{
+				parser.ReadNull();
+				items[i] = false;
+			}
+			else
+			{
+				uint64_t intValue = 0U;
+				if (tokenType != rs::detail::JsonTokenType::Number || !parser.ReadNumber(token, isInteger) || !ParseToken(token, isInteger, intValue))
+					return false;
+
+				items[i] = !!intValue;
+			}
+		}
+		else
+		{
+			if (tokenType != rs::detail::JsonTokenType::Number || !parser.ReadNumber(token, isInteger) || !ParseToken(token, isInteger, items[i]))
+				return false;
+		}
+
+		++i;
+	}
+
+	return !parser.HasError();
+}
+
+}
+
+namespace rs
+{
+
+StreamJsonReader::StreamJsonReader(std::istream& stream)
+{
+	std::size_t startOffset = stream.tellg();
+
+	stream.seekg(0, std::ios::end);
+	std::size_t bufferSize = static_cast<std::size_t>(stream.tellg()) - startOffset;
+	stream.seekg(startOffset, std::ios::beg);
+
+	if (bufferSize > 0U)
+	{
+		std::string buffer(bufferSize, '\0');
+		stream.read(&buffer[0], bufferSize);
+		buffer.resize(static_cast<std::size_t>(stream.gcount()));
+
+		m_source = std::make_unique<MemoryInputSource>(std::move(buffer));
+		InitParser();
+	}
+
+	if (!m_isOk)
+	{
+		// Revert stream back to original offset
+		stream.clear();
+		stream.seekg(startOffset, std::ios::beg);
+	}
+}
+
+StreamJsonReader::StreamJsonReader(std::string jsonContent)
+	: m_source(std::make_unique<MemoryInputSource>(std::move(jsonContent)))
+{
+	InitParser();
+}
+
+StreamJsonReader::StreamJsonReader(std::unique_ptr<InputSource>&& source)
+	: m_source(std::move(source))
+{
+	InitParser();
+}
+
+void StreamJsonReader::InitParser()
+{
+	if (m_source && m_source->IsOk())
+	{
+		m_parser = detail::JsonPullParser(m_source->GetData(), m_source->GetData() + m_source->GetSize());
+		m_isOk = (m_parser.Peek() != detail::JsonTokenType::Invalid);
+	}
+}
+
+bool StreamJsonReader::IndexContextObjects(uint64_t& masterObjectId)
+{
+	const char* rootPosition = m_parser.GetCursor();
+	const char* contextObjectsPosition = nullptr;
+	bool hasMasterObjectId = false;
+
+	if (m_parser.Peek() == detail::JsonTokenType::Object)
+	{
+		// Objects list documents have only master object id and objects list members, so stop at the first other member
+		m_parser.BeginObject();
+
+		std::string_view key;
+		while (m_parser.NextMember(key))
+		{
+			if (key == K_MASTER_OBJ_ID && m_parser.Peek() == detail::JsonTokenType::Number)
+			{
+				ReadResult idReadResult = ReadIntegral(rttr::Reflect<uint64_t>(), &masterObjectId);
+				hasMasterObjectId = idReadResult.Succeeded();
+			}
+			else if (key == K_CONTEXT_OBJECTS && m_parser.Peek() == detail::JsonTokenType::Array)
+			{
+				contextObjectsPosition = m_parser.GetCursor();
+				m_parser.SkipValue();
+			}
+			else if (hasMasterObjectId || nullptr != contextObjectsPosition)
+			{
+				m_parser.SkipValue();
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+
+	const bool hasObjectsList = hasMasterObjectId && nullptr != contextObjectsPosition && !m_parser.HasError();
+	if (hasObjectsList)
+	{
+		// Index objects list, only ids are parsed here, object values are skipped
+		m_parser.SetCursor(contextObjectsPosition);
+		m_parser.BeginArray();
+
+		while (m_parser.NextItem())
+		{
+			if (m_parser.Peek() != detail::JsonTokenType::Object)
+			{
+				m_parser.SkipValue();
+				continue;
+			}
+
+			uint64_t objectId = 0U;
+			bool hasId = false;
+			const char* objectValuePosition = nullptr;
+
+			m_parser.BeginObject();
+
+			std::string_view key;
+			while (m_parser.NextMember(key))
+			{
+				if (key == K_CONTEXT_OBJ_ID && m_parser.Peek() == detail::JsonTokenType::Number)
+				{
+					hasId = ReadIntegral(rttr::Reflect<uint64_t>(), &objectId).Succeeded();
+				}
+				else
+				{
+					if (key == K_CONTEXT_OBJ_VAL)
+					{
+						objectValuePosition = m_parser.GetCursor();
+					}
+
+					m_parser.SkipValue();
+				}
+			}
+
+			if (hasId && nullptr != objectValuePosition)
+			{
+				m_contextObjectsIndex.emplace(objectId, objectValuePosition);
+			}
+		}
+	}
+
+	m_parser.SetCursor(rootPosition);
+
+	return hasObjectsList && !m_parser.HasError();
+}
+
+void StreamJsonReader::ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const char* objectValuePosition)
+{
+	m_parser.SetCursor(objectValuePosition);
+	ReadResult objectReadResult = ReadImpl(type, value);
+
+	if (objectReadResult.success)
+	{
+		m_context->AddObject(objectId, type, value);
+	}
+	else
+	{
+		RS_LOG_ERROR("Failed to read context object!");
+	}
+}
+
+void StreamJsonReader::DoRead(const rttr::Type& type, void* value)
+{
+	uint64_t masterObjectId = 0U;
+	m_hasObjectsList = IndexContextObjects(masterObjectId);
+
+	if (m_hasObjectsList)
+	{
+		auto masterObjectIt = m_contextObjectsIndex.find(masterObjectId);
+		if (masterObjectIt != m_contextObjectsIndex.end())
+		{
+			// Parse master object, it's marked as visited first, so references to it are not queued
+			MarkContextObjectVisited(masterObjectId);
+			ReadContextObject(type, value, masterObjectId, masterObjectIt->second);
+
+			// Handle referenced context objects, each of them is queued only once, so every object is loaded exactly one time
+			std::pair<uint64_t, rttr::Type> objectReference;
+			while (PopPendingContextObject(objectReference))
+			{
+				bool contextObjectValid = false;
+
+				auto contextObjectIt = m_contextObjectsIndex.find(objectReference.first);
+				if (contextObjectIt != m_contextObjectsIndex.end())
+				{
+					rttr::Type pointedType = objectReference.second;
+
+					if (pointedType.IsValid())
+					{
+						// Check actual type of polymorphic type
+						if (pointedType.IsPolymorphic())
+						{
+							const char* typeIdPosition = m_parser.FindMemberValue(contextObjectIt->second, K_TYPE_ID);
+							if (nullptr != typeIdPosition)
+							{
+								std::string_view typeName;
+								m_parser.SetCursor(typeIdPosition);
+
+								if (m_parser.ReadString(typeName))
+								{
+									rttr::Type deducedType = rttr::Reflect(std::string(typeName).c_str());
+									if (deducedType.IsValid() && deducedType.IsBaseClass(pointedType))
+									{
+										pointedType = deducedType;
+									}
+								}
+							}
+						}
+
+						void* pointedValue = pointedType.Instantiate();
+						if (nullptr != pointedValue)
+						{
+							ReadContextObject(pointedType, pointedValue, objectReference.first, contextObjectIt->second);
+							contextObjectValid = true;
+						}
+					}
+				}
+
+				if (!contextObjectValid)
+				{
+					m_context->AddObject(objectReference.first, objectReference.second, nullptr);
+				}
+			}
+		}
+		else
+		{
+			RS_LOG_ERROR("Master object not found in the context objects list!");
+		}
+	}
+	else
+	{
+		// We have single object, simply read it here
+		ReadImpl(type, value);
+	}
+
+	if (m_parser.HasError())
+	{
+		RS_LOG_ERROR("Json parse error at offset %llu!", static_cast<unsigned long long>(m_parser.GetErrorOffset()));
+	}
+}
+
+bool StreamJsonReader::CheckSourceHasObjectsList()
+{
+	return m_hasObjectsList;
+}
+
+ReadResult StreamJsonReader::SkipMismatchedValue()
+{
+	m_parser.SkipValue();
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult StreamJsonReader::ReadObjectBases(const rttr::Type& type, void* value)
+{
+	if (m_parser.Peek() != detail::JsonTokenType::Array)
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::OKResult();
+	const auto& baseClassesInfo = type.GetBaseClasses();
+
+	m_parser.BeginArray();
+	while (m_parser.NextItem())
+	{
+		const char* baseValuePosition = m_parser.GetCursor();
+		bool baseClassResolved = false;
+
+		if (m_parser.Peek() == detail::JsonTokenType::Object)
+		{
+			// Lookup base class name first, then read the base part from the same json object
+			const char* baseIdPosition = m_parser.FindMemberValue(baseValuePosition, K_BASE_ID);
+			if (nullptr != baseIdPosition)
+			{
+				std::string_view baseName;
+				m_parser.SetCursor(baseIdPosition);
+				m_parser.ReadString(baseName);
+
+				for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+				{
+					rttr::Type baseClass = baseClassesInfo.first[i];
+					if (baseName == baseClass.GetName())
+					{
+						m_parser.SetCursor(baseValuePosition);
+						ReadResult baseReadResult = ReadImpl(baseClass, value);
+						result.Merge(baseReadResult);
+
+						baseClassResolved = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (!baseClassResolved)
+		{
+			RS_LOG_ERROR("Base class of '%s' not resolved!", type.GetName());
+
+			m_parser.SetCursor(baseValuePosition);
+			m_parser.SkipValue();
+		}
+	}
+
+	return result;
+}
+
+ReadResult StreamJsonReader::ReadObjectProperties(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::OKResult(); // If we have no properties, it's OK
+
+	const bool isCollection = type.IsCollection();
+
+	// Members are resolved using shape of the previous object of this type, so homogeneous objects cost one key comparison per member
+	detail::ObjectShapeCache::Shape& shape = m_shapeCache.GetShape(type);
+	std::size_t memberPosition = 0U;
+
+	m_parser.BeginObject();
+
+	std::string_view key;
+	while (m_parser.NextMember(key))
+	{
+		const std::size_t propertyIdx = shape.Resolve(type, memberPosition++, key);
+		if (propertyIdx == rttr::k_invalidPropertyIndex)
+		{
+			if (key == K_BASES)
+			{
+				ReadResult basesReadResult = ReadObjectBases(type, value);
+				result.Merge(basesReadResult);
+			}
+			else if (isCollection && key == K_COLLECTION_ITEMS)
+			{
+				ReadResult collectionReadResult = ReadCollection(type, value);
+				result.Merge(collectionReadResult);
+			}
+			else
+			{
+				// If we couldn't find the property for json member, just skip it, and produce no error
+				m_parser.SkipValue();
+			}
+
+			continue;
+		}
+
+		rttr::Property* property = type.GetProperty(propertyIdx);
+		const rttr::Type& propertyType = property->GetType();
+
+		RS_LOG_TRACE("Reading property '%s::%s'", type.GetName(), property->GetName());
+
+		// Decide to create temp variable or not
+		void* propertyValuePtr = nullptr;
+		bool needsTempVar = property->NeedsTempVariable();
+
+		if (needsTempVar)
+		{
+			propertyValuePtr = m_context->CreateTempVariable(propertyType);
+		}
+		else
+		{
+			propertyValuePtr = property->GetValueAddress(value);
+		}
+
+		// Read value
+		ReadResult propertyReadResult = ReadImpl(propertyType, propertyValuePtr);
+
+		if (propertyReadResult.Succeeded())
+		{
+			// We have succeeded, now call property mutator function to apply temp
+			property->CallMutator(value, propertyValuePtr);
+
+			// As we already applied value to target, we can release temp variable
+			if (needsTempVar)
+			{
+				m_context->DestroyTempVariable(propertyValuePtr);
+			}
+		}
+		else
+		{
+			if (!propertyReadResult.allEntitiesResolved)
+			{
+				// If not all property value entities are resolved, make use of deferred commands list
+				auto callMutatorAction = std::make_unique<detail::CallObjectMutatorAction>(0, property, value, propertyValuePtr);
+				m_deferredCommandsList.push_back(std::move(callMutatorAction));
+
+				// Notify calling code that not all entities are resolved for this object
+				result.allEntitiesResolved = false;
+			}
+		}
+	}
+
+	return result;
+}
+
+ReadResult StreamJsonReader::ReadCollection(const rttr::Type& type, void* value)
+{
+	if (m_parser.Peek() != detail::JsonTokenType::Array)
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::GenericFailResult();
+
+	// We have correct json value with items data, now get collection traits from meta type
+	std::unique_ptr<rttr::CollectionInserterBase> inserter = type.CreateCollectionInserter(value);
+	rttr::Type collectionItemType = type.GetCollectionItemType();
+
+	if (!inserter || !collectionItemType.IsValid())
+		return SkipMismatchedValue();
+
+	// If we reach here, we have a valid collection
+	result.success = true;
+
+	// Cursor is at array start here, as it was already peeked
+	const char* arrayStart = m_parser.GetCursor();
+
+	const bool isBulkNumeric = collectionItemType.IsPlainNumeric() && type.IsContiguousCollection();
+
+	// Items are counted only when it pays off, as lookahead over nested values costs more than geometric growth of
+	// collection storage. Items which may reference objects are emplaced within exactly reserved storage, so deferred
+	// actions pointing to them stay valid and items keep their order. Other items are read through temps
+	if (isBulkNumeric || (type.CanReserveCollection() && collectionItemType.CanReferenceObjects()))
+	{
+		const std::size_t itemsCount = m_parser.CountArrayItems(arrayStart);
+
+		// Contiguous collections of numbers are filled at once, skipping per item dispatch
+		if (isBulkNumeric)
+		{
+			void* items = type.AppendCollectionItems(value, itemsCount);
+			if (nullptr != items)
+			{
+				if (ReadNumericItems(collectionItemType.GetNumericKind(), items, itemsCount))
+					return result;
+
+				// Roll back and read items one by one
+				type.RemoveCollectionItems(value, itemsCount);
+				m_parser.SetCursor(arrayStart);
+			}
+		}
+
+		type.ReserveCollection(value, itemsCount);
+		inserter->SetReservedItemsCount(itemsCount);
+	}
+
+	m_parser.BeginArray();
+
+	int i = 0;
+	while (m_parser.NextItem())
+	{
+		RS_LOG_TRACE("Reading collection item %d", i);
+
+		// Prefer reading straight into collection storage, it saves temp object and a copy per item
+		void* collectionItem = inserter->Emplace();
+		if (nullptr != collectionItem)
+		{
+			ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem);
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Item stays in place, deferred actions will complete it
+				result.allEntitiesResolved = false;
+			}
+			else if (!itemReadResult.success)
+			{
+				RS_LOG_ERROR("Collection item failed to be read!");
+				inserter->CancelEmplace();
+			}
+
+			++i;
+			continue;
+		}
+
+		collectionItem = m_context->CreateTempVariable(collectionItemType);
+		ReadResult itemReadResult = ReadImpl(collectionItemType, collectionItem);
+
+		if (itemReadResult.Succeeded())
+		{
+			// Item read successfully, so we can safely insert here and release item temp variable
+			inserter->InsertMove(collectionItem);
+			m_context->DestroyTempVariable(collectionItem);
+		}
+		else
+		{
+			RS_LOG_ERROR("Collection item failed to be read!");
+
+			if (!itemReadResult.allEntitiesResolved)
+			{
+				// Notify caller that not all entities are resolved, and we must now defer actions using commands list
+				result.allEntitiesResolved = false;
+
+				// Not all entities of collection item are resolved, put insert command to deferred commands list
+				auto insertAction = std::make_unique<detail::CollectionInsertAction>(0, type.CreateCollectionInserter(value), collectionItem);
+				m_deferredCommandsList.push_back(std::move(insertAction));
+			}
+
+			// For other error cases, we just skip the item and don't add it to final collection
+		}
+
+		++i;
+	}
+
+	return result;
+}
+
+ReadResult StreamJsonReader::ReadPointer(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+
+	switch (m_parser.Peek())
+	{
+		case detail::JsonTokenType::Null:
+		{
+			// Resolve null pointer
+			m_parser.ReadNull();
+			rttr::AssignPointerValue(value, nullptr);
+			result = ReadResult::OKResult();
+		}
+		break;
+		case detail::JsonTokenType::Number:
+		{
+			uint64_t objectId = 0U;
+			if (!ReadIntegral(rttr::Reflect<uint64_t>(), &objectId).Succeeded())
+				break;
+
+			EnqueueContextObject(objectId, type.GetPointedType());
+
+			result = ReadResult::OKResult();
+
+			// If we have resolved pointer address right now, use it
+			auto referencedObjectData = m_context->GetObjectById(objectId);
+			if (nullptr != referencedObjectData)
+			{
+				rttr::AssignPointerValue(value, referencedObjectData->objectPtr);
+			}
+			else
+			{
+				// Pointer can't be resolved right now, so put resolve action into deferred commands list
+				auto resolvePtrAction = std::make_unique<detail::ResolvePointerAction>(0, m_context.get(), value, objectId);
+				m_deferredCommandsList.push_back(std::move(resolvePtrAction));
+
+				result.allEntitiesResolved = false;
+			}
+		}
+		break;
+		default:
+			result = SkipMismatchedValue();
+			break;
+	}
+
+	return result;
+}
+
+ReadResult StreamJsonReader::ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+
+	if (proxyTypeData->readConverter)
+	{
+		// Create proxy object
+		void* proxyObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+
+		// Read proxy object
+		result = ReadImpl(proxyTypeData->proxyType, proxyObject);
+
+		// Create target object using proxy constructor
+		proxyTypeData->readConverter->Convert(value, proxyObject);
+	}
+	else
+	{
+		RS_LOG_ERROR("Type has proxy type, but no read converter defined!");
+		m_parser.SkipValue();
+	}
+
+	return result;
+}
+
+ReadResult StreamJsonReader::ReadAdapter(rs::SerializationAdapter* adapter, void* value)
+{
+	const char* valuePosition = m_parser.GetCursor();
+
+	auto readPayload = [&](SerializationAdapter::DataChunk& payload)
+	{
+		if (!payload.type.IsValid() || m_parser.Peek() != detail::JsonTokenType::Object)
+			return ReadResult::OKResult();
+
+		// If it's a json object with adapter member, treat it as payload
+		const char* payloadPosition = m_parser.FindMemberValue(valuePosition, K_ADAPTER);
+		if (nullptr == payloadPosition)
+			return ReadResult::OKResult();
+
+		payload.value = m_context->CreateTempVariable(payload.type);
+
+		m_parser.SetCursor(payloadPosition);
+		return ReadImpl(payload.type, payload.value);
+	};
+
+	auto readValue = [&](const rttr::Type& type, void* adapterValue)
+	{
+		// Read json value as converted type, payload member will be skipped as unknown property
+		m_parser.SetCursor(valuePosition);
+
+		if (nullptr == adapterValue)
+		{
+			m_parser.SkipValue();
+			return ReadResult::GenericFailResult();
+		}
+
+		return ReadImpl(type, adapterValue);
+	};
+
+	return ReadAdapterData(adapter, value, readPayload, readValue);
+}
+
+ReadResult StreamJsonReader::ReadArray(const rttr::Type& type, void* value)
+{
+	if (m_parser.Peek() != detail::JsonTokenType::Array)
+		return SkipMismatchedValue();
+
+	ReadResult result = ReadResult::OKResult();
+
+	rttr::Type arrayType = type.GetArrayType();
+	uint8_t* arrayBytePtr = static_cast<uint8_t*>(value);
+	std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	// Arrays of numbers are filled at once, skipping per item dispatch
+	if (arrayType.IsPlainNumeric())
+	{
+		const char* arrayStart = m_parser.GetCursor();
+		if (ReadNumericItems(arrayType.GetNumericKind(), value, totalSize))
+			return result;
+
+		// Roll back and read items one by one
+		m_parser.SetCursor(arrayStart);
+	}
+
+	m_parser.BeginArray();
+
+	std::size_t i = 0U;
+	while (m_parser.NextItem())
+	{
+		if (i >= totalSize)
+		{
+			// Remaining items still have to be consumed to keep parser in sync
+			if (i == totalSize)
+			{
+				RS_LOG_WARNING("Actual json array doesn't fit in target array size!");
+			}
+
+			m_parser.SkipValue();
+			++i;
+			continue;
+		}
+
+		uint8_t* itemPtr = arrayBytePtr + itemSize * i;
+		ReadResult itemResult = ReadImpl(arrayType, itemPtr);
+
+		if (!itemResult.Succeeded())
+		{
+			if (!itemResult.allEntitiesResolved)
+			{
+				result.allEntitiesResolved = false;
+			}
+		}
+
+		++i;
+	}
+
+	return result;
+}
+
+bool StreamJsonReader::ReadNumericItems(const rttr::NumericKind kind, void* items, const std::size_t maxCount)
+{
+	return rttr::VisitNumericKind(kind, [this, items, maxCount](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+		return ::ReadNumericItems(m_parser, static_cast<T*>(items), maxCount);
+	});
+}
+
+ReadResult StreamJsonReader::ReadReal(const rttr::Type& type, void* value)
+{
+	ReadResult result = ReadResult::GenericFailResult();
+	const bool isFloat = (type.GetTypeIndex() == typeid(float));
+
+	// Floats are parsed with float rounding, not through double
+	float floatValue = 0.0f;
+	double doubleValue = 0.0;
+
+	if (m_parser.Peek() == detail::JsonTokenType::Number)
+	{
+		std::string_view token;
+		bool isInteger = false;
+
+		if (m_parser.ReadNumber(token, isInteger) && (isFloat ? ParseToken(token, isInteger, floatValue) : ParseToken(token, isInteger, doubleValue)))
+		{
+			result = ReadResult::OKResult();
+		}
+	}
+	else
+	{
+		m_parser.SkipValue();
+	}
+
+	if (isFloat)
+	{
+		*static_cast<float*>(value) = floatValue;
+	}
+	else
+	{
+		*static_cast<double*>(value) = doubleValue;
+	}
+
+	return result;
+}
+
+ReadResult StreamJsonReader::ReadIntegral(const rttr::Type& type, void* value)
+{
+	const detail::JsonTokenType tokenType = m_parser.Peek();
+
+	if (type.GetTypeIndex() == typeid(bool))
+	{
+		switch (tokenType)
+		{
+			case detail::JsonTokenType::Boolean:
+			{
+				bool boolValue = false;
+				m_parser.ReadBool(boolValue);
+				*static_cast<bool*>(value) = boolValue;
+				return ReadResult::OKResult();
+			}
+			case detail::JsonTokenType::Null:
+			{
+				m_parser.ReadNull();
+				*static_cast<bool*>(value) = false;
+				return ReadResult::OKResult();
+			}
+			case detail::JsonTokenType::Number:
+			{
+				std::string_view token;
+				bool isInteger = false;
+				uint64_t intValue = 0U;
+
+				if (m_parser.ReadNumber(token, isInteger) && ParseToken(token, isInteger, intValue))
+				{
+					*static_cast<bool*>(value) = !!intValue;
+					return ReadResult::OKResult();
+				}
+			}
+			break;
+			default:
+				break;
+		}
+
+		return SkipMismatchedValue();
+	}
+
+	if (tokenType != detail::JsonTokenType::Number)
+		return SkipMismatchedValue();
+
+	std::string_view token;
+	bool isInteger = false;
+	if (!m_parser.ReadNumber(token, isInteger))
+		return ReadResult::GenericFailResult();
+
+	// Token is parsed straight into destination width
+	bool isParsed = false;
+
+	if (type.IsSignedIntegral())
+	{
+		switch (type.GetSize())
+		{
+		case 1:
+			isParsed = ParseToken(token, isInteger, *static_cast<int8_t*>(value));
+			break;
+		case 2:
+			isParsed = ParseToken(token, isInteger, *static_cast<int16_t*>(value));
+			break;
+		case 4:
+			isParsed = ParseToken(token, isInteger, *static_cast<int32_t*>(value));
+			break;
+		case 8:
+		default:
+			isParsed = ParseToken(token, isInteger, *static_cast<int64_t*>(value));
+			break;
+		}
+	}
+	else
+	{
+		switch (type.GetSize())
+		{
+		case 1:
+			isParsed = ParseToken(token, isInteger, *static_cast<uint8_t*>(value));
+			break;
+		case 2:
+			isParsed = ParseToken(token, isInteger, *static_cast<uint16_t*>(value));
+			break;
+		case 4:
+			isParsed = ParseToken(token, isInteger, *static_cast<uint32_t*>(value));
+			break;
+		case 8:
+		default:
+			isParsed = ParseToken(token, isInteger, *static_cast<uint64_t*>(value));
+			break;
+		}
+	}
+
+	if (!isParsed)
+		return ReadResult::GenericFailResult();
+
+	return ReadResult::OKResult();
+}
+
+ReadResult StreamJsonReader::ReadStdString(void* value)
+{
+	switch (m_parser.Peek())
+	{
+		case detail::JsonTokenType::Null:
+		{
+			m_parser.ReadNull();
+			*static_cast<std::string*>(value) = std::string();
+			return ReadResult::OKResult();
+		}
+		case detail::JsonTokenType::String:
+		{
+			std::string_view str;
+			if (m_parser.ReadString(str))
+			{
+				static_cast<std::string*>(value)->assign(str.data(), str.size());
+				return ReadResult::OKResult();
+			}
+		}
+		break;
+		default:
+			return SkipMismatchedValue();
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult StreamJsonReader::ReadCString(void* value)
+{
+	char** strSerializedValue = reinterpret_cast<char**>(value);
+
+	switch (m_parser.Peek())
+	{
+		case detail::JsonTokenType::Null:
+		{
+			m_parser.ReadNull();
+			*strSerializedValue = nullptr;
+			return ReadResult::OKResult();
+		}
+		case detail::JsonTokenType::String:
+		{
+			std::string_view str;
+			if (m_parser.ReadString(str))
+			{
+				const std::string& storedStr = m_cStringsStorage.emplace_back(str);
+				*strSerializedValue = const_cast<char*>(storedStr.c_str());
+				return ReadResult::OKResult();
+			}
+		}
+		break;
+		default:
+			return SkipMismatchedValue();
+	}
+
+	return ReadResult::GenericFailResult();
+}
+
+ReadResult StreamJsonReader::ReadImpl(const rttr::Type& type, void* value)
+{
+	assert(m_isOk);
+
+	// Predefined types are resolved with codec slot of the type
+	switch (type.GetPredefinedType())
+	{
+		case rs::PredefinedType::StdString:
+			return ReadStdString(value);
+		case rs::PredefinedType::CString:
+			return ReadCString(value);
+		default:
+			break;
+	}
+
+	ReadResult result = ReadResult::GenericFailResult();
+	rs::SerializationMethod serializationMethod = type.GetSerializationMethod();
+
+	switch (serializationMethod)
+	{
+		case rs::SerializationMethod::Proxy:
+		{
+			rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+			if (nullptr != proxyTypeData)
+			{
+				result = ReadProxy(proxyTypeData, value);
+			}
+			else
+			{
+				m_parser.SkipValue();
+			}
+		}
+		break;
+		case rs::SerializationMethod::Adapter:
+		{
+			SerializationAdapter* adapter = type.GetSerializationAdapter();
+			if (nullptr != adapter)
+			{
+				result = ReadAdapter(adapter, value);
+			}
+			else
+			{
+				m_parser.SkipValue();
+			}
+		}
+		break;
+		default:
+		{
+			switch (type.GetTypeClass())
+			{
+				case rttr::TypeClass::Object:
+				{
+					const detail::JsonTokenType tokenType = m_parser.Peek();
+
+					if (tokenType == detail::JsonTokenType::Object)
+					{
+						// Bases, properties and collection items are all read in a single pass over object members
+						result = ReadObjectProperties(type, value);
+					}
+					else if (tokenType == detail::JsonTokenType::Array && type.IsCollection() && type.GetPropertiesCount() == 0U)
+					{
+						// If this type has no properties, and declared as array in json, use it as items container
+						result = ReadCollection(type, value);
+					}
+					else
+					{
+						result = SkipMismatchedValue();
+					}
+				}
+				break;
+				case rttr::TypeClass::Pointer:
+				{
+					result = ReadPointer(type, value);
+				}
+				break;
+				case rttr::TypeClass::Enum:
+				{
+					rttr::Type enumUnderlyingType = type.GetEnumUnderlyingType();
+					result = ReadImpl(enumUnderlyingType, value);
+				}
+				break;
+				case rttr::TypeClass::Real:
+				{
+					result = ReadReal(type, value);
+				}
+				break;
+				case rttr::TypeClass::Integral:
+				{
+					result = ReadIntegral(type, value);
+				}
+				break;
+				case rttr::TypeClass::Array:
+				{
+					result = ReadArray(type, value);
+				}
+				break;
+				default:
+				{
+					result = SkipMismatchedValue();
+				}
+				break;
+			}
+		}
+		break;
+	}
+
+	return result;
+}
+
+bool StreamJsonReader::IsOk() const
+{
+	return m_isOk;
+}
+
+} // namespace rs
@@ -0,0 +1,78 @@
+#pragma once
+#include "readers/BaseReader.hpp"
+#include "readers/JsonPullParser.hpp"
+#include "readers/InputSource.hpp"
+#include "readers/ObjectShapeCache.hpp"
+#include "rttr/Type.hpp"
+
+#include <istream>
+#include <string>
+#include <deque>
+#include <unordered_map>
+
+namespace rs
+{
+
+/*
+* @brief Streaming json reader implementation
+*
+* Unlike JsonReader, no document tree is built. Values are deserialized straight from the tokens of source text,
+* so peak memory is the source buffer, target objects and small parse state.
+* Context objects list is indexed once by scanning it without materializing anything, and each object is read on demand.
+*/
+class StreamJsonReader
+	: public BaseReader
+{
+public:
+	explicit RAVEN_SERIALIZE_API StreamJsonReader(std::istream& stream);
+	explicit RAVEN_SERIALIZE_API StreamJsonReader(std::string jsonContent);
+	// Reads directly from source memory, for example from MappedFileInputSource, source is kept alive by the reader
+	explicit RAVEN_SERIALIZE_API StreamJsonReader(std::unique_ptr<InputSource>&& source);
+	RAVEN_SERIALIZE_API ~StreamJsonReader() = default;
+
+	bool RAVEN_SERIALIZE_API IsOk() const final;
+
+protected:
+	void DoRead(const rttr::Type& type, void* value) final;
+	bool CheckSourceHasObjectsList() final;
+
+private:
+	void InitParser();
+
+	// Primary function to read any object type, consumes exactly one json value from the parser
+	ReadResult ReadImpl(const rttr::Type& type, void* value);
+
+	// Scans root object for context objects list, and builds objects index if it's present
+	bool IndexContextObjects(uint64_t& masterObjectId);
+	void ReadContextObject(const rttr::Type& type, void* value, const uint64_t objectId, const char* objectValuePosition);
+
+	ReadResult ReadProxy(rttr::TypeProxyData* proxyTypeData, void* value);
+	ReadResult ReadAdapter(rs::SerializationAdapter* adapter, void* value);
+	// Read object members in the order they appear in source, dispatching them to properties, bases or collection items
+	ReadResult ReadObjectProperties(const rttr::Type& type, void* value);
+	ReadResult ReadCollection(const rttr::Type& type, void* value);
+	ReadResult ReadObjectBases(const rttr::Type& type, void* value);
+	ReadResult ReadPointer(const rttr::Type& type, void* value);
+	ReadResult ReadArray(const rttr::Type& type, void* value);
+	// Reads json array of numbers straight into items storage, parser position is undefined on failure
+	bool ReadNumericItems(const rttr::NumericKind kind, void* items, const std::size_t maxCount);
+	ReadResult ReadReal(const rttr::Type& type, void* value);
+	ReadResult ReadIntegral(const rttr::Type& type, void* value);
+	ReadResult ReadStdString(void* value);
+	ReadResult ReadCString(void* value);
+
+	// Skips current value and returns failed result, used to keep parser in sync on type mismatch
+	ReadResult SkipMismatchedValue();
+
+private:
+	std::unique_ptr<InputSource> m_source;
+	detail::JsonPullParser m_parser;
+	// Position of context object '$val$' json value by object id
+	std::unordered_map<uint64_t, const char*> m_contextObjectsIndex;
+	detail::ObjectShapeCache m_shapeCache;
+	// Storage for strings, read as const char*, they must outlive the reader
+	std::deque<std::string> m_cStringsStorage;
+	bool m_isOk = false;
+};
+
+} // namespace rs
@@ -0,0 +1,131 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace rs
+{
+namespace detail
+{
+
+/*
+* @brief Compact binary format shared by BinaryWriter and BinaryReader
+*
+* Layout:
+* - Header: magic "RSB", format version, flags (byte order of raw values), 8 bytes schema hash of the root type
+* - Length prefixed schema table of written types (see BinarySchema.hpp), root type is the first node
+* - Varint objects count, zero means single root value follows
+* - Otherwise varint master object id, then objects list, each object is: varint id, length prefixed type name
+* (empty if object has static type of the pointer), varint schema node index, length prefixed value bytes
+* - Objects index, if header has objects index flag: records of 8 bytes object id and 8 bytes absolute offset of the object
+* in the objects list, sorted by id, then 8 bytes absolute offset of the first record. Objects are located with binary search,
+* so any object is read without parsing the objects list
+*
+* Values are encoded by their meta type only, nothing is tagged:
+* - unsigned integers are varints, signed integers are zigzag varints, bool and 8 bit integers are single bytes
+* - floating point numbers and blittable values are raw bytes in writer byte order
+* - strings are length prefixed, const char* strings store length + 1, so zero means null
+* - objects are bases in declaration order, then properties values in declaration order,
+* then varint items count and items if object is a collection
+* - pointers are varint object id, zero is null
+* - proxy types are their proxy value, adapters are flags byte, then payload and value if present
+*/
+namespace binary
+{
+
+constexpr char k_magic[3] = { 'R', 'S', 'B' };
+constexpr uint8_t k_version = 2U;
+constexpr std::size_t k_headerSize = 13U;
+constexpr std::size_t k_schemaHashPosition = 5U;
+
+// Header flags
+constexpr uint8_t k_flagBigEndian = 0x01U;
+constexpr uint8_t k_flagObjectsIndex = 0x02U;
+
+constexpr std::size_t k_objectsIndexRecordSize = 16U;
+
+// Adapter value flags
+constexpr uint8_t k_adapterPayload = 0x01U;
+constexpr uint8_t k_adapterValue = 0x02U;
+
+inline uint64_t ZigZagEncode(const int64_t value)
+{
+	return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t ZigZagDecode(const uint64_t value)
+{
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1U);
+}
+
+// Longest varint of 64 bit value
+constexpr std::size_t k_maxVarUIntSize = 10U;
+
+// Encodes varint into bytes, which must fit k_maxVarUIntSize bytes, returns encoded size
+inline std::size_t EncodeVarUInt(char* bytes, uint64_t value)
+{
+	std::size_t count = 0U;
+
+	while (value >= 0x80U)
+	{
+		bytes[count++] = static_cast<char>((value & 0x7FU) | 0x80U);
+		value >>= 7;
+	}
+
+	bytes[count++] = static_cast<char>(value);
+	return count;
+}
+
+inline void AppendVarUInt(std::string& buffer, const uint64_t value)
+{
+	char bytes[k_maxVarUIntSize];
+	buffer.append(bytes, EncodeVarUInt(bytes, value));
+}
+
+// Schema hashes are stored in little endian byte order
+inline void EncodeUInt64(char* bytes, const uint64_t value)
+{
+	for (std::size_t i = 0U; i < sizeof(uint64_t); ++i)
+	{
+		bytes[i] = static_cast<char>(value >> (8U * i));
+	}
+}
+
+inline void AppendUInt64(std::string& buffer, const uint64_t value)
+{
+	char bytes[sizeof(uint64_t)];
+	EncodeUInt64(bytes, value);
+	buffer.append(bytes, sizeof(bytes));
+}
+
+inline uint64_t ReadUInt64(const char* data)
+{
+	uint64_t value = 0U;
+	for (std::size_t i = 0U; i < 8U; ++i)
+	{
+		value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8U * i);
+	}
+
+	return value;
+}
+
+// Decodes varint at cursor, returns false if data ends before varint does, or varint is longer than 64 bits
+inline bool ReadVarUInt(const char*& cursor, const char* end, uint64_t& value)
+{
+	value = 0U;
+
+	for (unsigned shift = 0U; shift < 64U && cursor < end; shift += 7U)
+	{
+		const uint8_t byte = static_cast<uint8_t>(*cursor++);
+		value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+
+		if ((byte & 0x80U) == 0U)
+			return true;
+	}
+
+	return false;
+}
+
+} // namespace binary
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,533 @@
+#include "rs/BinarySchema.hpp"
+#include "rs/BinaryFormat.hpp"
+#include "rttr/Property.hpp"
+#include "rttr/TypeProxyData.hpp"
+
+#include <algorithm>
+
+namespace rs
+{
+namespace detail
+{
+namespace binary
+{
+
+namespace
+{
+
+constexpr uint64_t k_fnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t k_fnvPrime = 1099511628211ULL;
+constexpr std::size_t k_noCycle = static_cast<std::size_t>(-1);
+
+// Values are hashed byte by byte in fixed order, so hash doesn't depend on host byte order
+void HashValue(uint64_t& hash, uint64_t value)
+{
+	for (int i = 0; i < 8; ++i)
+	{
+		hash ^= (value & 0xFFU);
+		hash *= k_fnvPrime;
+		value >>= 8;
+	}
+}
+
+void HashString(uint64_t& hash, std::string_view str)
+{
+	HashValue(hash, str.size());
+
+	for (const char c : str)
+	{
+		hash ^= static_cast<uint8_t>(c);
+		hash *= k_fnvPrime;
+	}
+}
+
+void AppendString(std::string& buffer, std::string_view str)
+{
+	AppendVarUInt(buffer, str.size());
+	buffer.append(str.data(), str.size());
+}
+
+bool ReadString(const char*& cursor, const char* end, std::string_view& str)
+{
+	uint64_t length = 0U;
+	if (!ReadVarUInt(cursor, end, length) || length > static_cast<uint64_t>(end - cursor))
+		return false;
+
+	str = std::string_view(cursor, static_cast<std::size_t>(length));
+	cursor += length;
+	return true;
+}
+
+std::size_t GetArrayItemsCount(const rttr::Type& type)
+{
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	return totalSize;
+}
+
+// Type names of user types are hashed, other types have compiler specific mangled names, so they are identified by their structure
+void HashTypeName(uint64_t& hash, const rttr::Type& type)
+{
+	if (type.IsUserDefined())
+	{
+		HashString(hash, type.GetName());
+		return;
+	}
+
+	const SchemaKind kind = GetSchemaKind(type);
+	HashValue(hash, static_cast<uint64_t>(kind));
+
+	switch (type.GetTypeClass())
+	{
+	case rttr::TypeClass::Pointer:
+		HashTypeName(hash, GetSchemaType(type.GetPointedType()));
+		break;
+	case rttr::TypeClass::Array:
+		HashValue(hash, GetArrayItemsCount(type));
+		HashTypeName(hash, GetSchemaType(type.GetArrayType()));
+		break;
+	case rttr::TypeClass::Object:
+	{
+		// Implicit object types can't refer to themselves, as only user types can, so recursion stops at user types
+		const std::size_t propertiesCount = type.GetPropertiesCount();
+		HashValue(hash, propertiesCount);
+
+		for (std::size_t i = 0U; i < propertiesCount; ++i)
+		{
+			rttr::Property* const prop = type.GetProperty(i);
+
+			HashString(hash, prop->GetName());
+			HashTypeName(hash, GetSchemaType(prop->GetType()));
+		}
+
+		if (type.IsCollection())
+		{
+			HashTypeName(hash, GetSchemaType(type.GetCollectionItemType()));
+		}
+	}
+	break;
+	default:
+		// Strings size is standard library specific, and isn't a part of their encoding
+		if (kind != SchemaKind::String && kind != SchemaKind::CString)
+		{
+			HashValue(hash, type.GetSize());
+		}
+		break;
+	}
+}
+
+} // namespace
+
+SchemaKind GetSchemaKind(const rttr::Type& type)
+{
+	switch (type.GetPredefinedType())
+	{
+	case rs::PredefinedType::StdString:
+		return SchemaKind::String;
+	case rs::PredefinedType::CString:
+		return SchemaKind::CString;
+	default:
+		break;
+	}
+
+	if (type.GetSerializationMethod() != rs::SerializationMethod::Default)
+		return SchemaKind::Opaque;
+
+	switch (type.GetTypeClass())
+	{
+	case rttr::TypeClass::Object:
+		return type.IsBlittable() ? SchemaKind::BlittableObject : SchemaKind::Object;
+	case rttr::TypeClass::Pointer:
+		return SchemaKind::Pointer;
+	case rttr::TypeClass::Enum:
+		return GetSchemaKind(type.GetEnumUnderlyingType());
+	case rttr::TypeClass::Real:
+		return SchemaKind::Raw;
+	case rttr::TypeClass::Integral:
+	{
+		if (type.GetSize() == 1U)
+			return SchemaKind::Byte;
+
+		return type.IsSignedIntegral() ? SchemaKind::SignedVarInt : SchemaKind::UnsignedVarInt;
+	}
+	case rttr::TypeClass::Array:
+		return type.GetArrayType().IsBlittable() ? SchemaKind::Raw : SchemaKind::Array;
+	default:
+		return SchemaKind::Opaque;
+	}
+}
+
+rttr::Type GetSchemaType(const rttr::Type& type)
+{
+	rttr::Type schemaType = type;
+
+	while (schemaType.GetSerializationMethod() == rs::SerializationMethod::Proxy && schemaType.GetPredefinedType() == rs::PredefinedType::None)
+	{
+		rttr::TypeProxyData* proxyTypeData = schemaType.GetProxyType();
+		if (nullptr == proxyTypeData || !proxyTypeData->proxyType.IsValid())
+			break;
+
+		schemaType = proxyTypeData->proxyType;
+	}
+
+	return schemaType;
+}
+
+uint64_t SchemaHasher::GetHash(const rttr::Type& type)
+{
+	const rttr::Type schemaType = GetSchemaType(type);
+
+	auto it = m_hashes.find(schemaType);
+	if (it != m_hashes.end())
+		return it->second;
+
+	// Type refers to itself through collection items, it's hashed by name here, its layout is hashed by the outer call
+	auto stackIt = std::find(m_stack.begin(), m_stack.end(), schemaType);
+	if (stackIt != m_stack.end())
+	{
+		m_cycleIdx = std::min(m_cycleIdx, static_cast<std::size_t>(stackIt - m_stack.begin()));
+
+		uint64_t hash = k_fnvOffsetBasis;
+		HashTypeName(hash, schemaType);
+		return hash;
+	}
+
+	const std::size_t stackIdx = m_stack.size();
+	const std::size_t outerCycleIdx = m_cycleIdx;
+
+	m_stack.push_back(schemaType);
+	m_cycleIdx = k_noCycle;
+
+	const uint64_t hash = ComputeHash(schemaType);
+
+	m_stack.pop_back();
+
+	// Hash is cached only if it doesn't depend on types being hashed by outer calls, so it's the same regardless of call order
+	if (m_cycleIdx >= stackIdx)
+	{
+		m_hashes.emplace(schemaType, hash);
+		m_cycleIdx = outerCycleIdx;
+	}
+	else
+	{
+		m_cycleIdx = std::min(m_cycleIdx, outerCycleIdx);
+	}
+
+	return hash;
+}
+
+uint64_t SchemaHasher::ComputeHash(const rttr::Type& type)
+{
+	uint64_t hash = k_fnvOffsetBasis;
+
+	const SchemaKind kind = GetSchemaKind(type);
+	HashValue(hash, static_cast<uint64_t>(kind));
+
+	switch (kind)
+	{
+	case SchemaKind::Opaque:
+		HashTypeName(hash, type);
+		return hash;
+	case SchemaKind::String:
+	case SchemaKind::CString:
+		return hash;
+	case SchemaKind::Pointer:
+		HashTypeName(hash, GetSchemaType(type.GetPointedType()));
+		return hash;
+	default:
+		break;
+	}
+
+	switch (type.GetTypeClass())
+	{
+	case rttr::TypeClass::Array:
+	{
+		HashValue(hash, GetArrayItemsCount(type));
+		HashValue(hash, GetHash(type.GetArrayType()));
+	}
+	break;
+	case rttr::TypeClass::Object:
+	{
+		// Implicit types, like STL containers, are matched by their bases, properties and items only
+		if (type.IsUserDefined())
+		{
+			HashString(hash, type.GetName());
+		}
+
+		const auto& baseClassesInfo = type.GetBaseClasses();
+		HashValue(hash, baseClassesInfo.second);
+
+		for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+		{
+			HashValue(hash, GetHash(baseClassesInfo.first[i]));
+		}
+
+		// Raw bytes of blittable objects are matched by member offsets as well
+		const bool isBlittable = (kind == SchemaKind::BlittableObject);
+		if (isBlittable)
+		{
+			HashValue(hash, type.GetSize());
+		}
+
+		const std::size_t propertiesCount = type.GetPropertiesCount();
+		HashValue(hash, propertiesCount);
+
+		for (std::size_t i = 0U; i < propertiesCount; ++i)
+		{
+			rttr::Property* const prop = type.GetProperty(i);
+
+			HashString(hash, prop->GetName());
+			HashValue(hash, GetHash(prop->GetType()));
+
+			if (isBlittable)
+			{
+				HashValue(hash, prop->GetMemberOffset());
+			}
+		}
+
+		HashValue(hash, type.IsCollection() ? GetHash(type.GetCollectionItemType()) : 0U);
+	}
+	break;
+	default:
+		HashValue(hash, type.GetSize());
+		break;
+	}
+
+	return hash;
+}
+
+uint64_t SchemaTableWriter::AddType(const rttr::Type& type)
+{
+	const rttr::Type schemaType = GetSchemaType(type);
+
+	auto it = m_nodeIndices.find(schemaType);
+	if (it != m_nodeIndices.end())
+		return it->second;
+
+	// Index is taken before nested types are added, so types referring to themselves get it as well
+	const uint64_t nodeIdx = m_nodes.size();
+	m_nodeIndices.emplace(schemaType, nodeIdx);
+	m_nodes.emplace_back();
+
+	const SchemaKind kind = GetSchemaKind(schemaType);
+
+	std::string node;
+	node.push_back(static_cast<char>(kind));
+	AppendUInt64(node, m_hasher.GetHash(schemaType));
+
+	switch (kind)
+	{
+	case SchemaKind::Raw:
+		AppendVarUInt(node, schemaType.GetSize());
+		break;
+	case SchemaKind::Array:
+	{
+		AppendVarUInt(node, GetArrayItemsCount(schemaType));
+		AppendVarUInt(node, AddType(schemaType.GetArrayType()));
+	}
+	break;
+	case SchemaKind::BlittableObject:
+	{
+		AppendString(node, schemaType.GetName());
+		AppendVarUInt(node, schemaType.GetSize());
+
+		const std::size_t propertiesCount = schemaType.GetPropertiesCount();
+		AppendVarUInt(node, propertiesCount);
+
+		for (std::size_t i = 0U; i < propertiesCount; ++i)
+		{
+			rttr::Property* const prop = schemaType.GetProperty(i);
+
+			AppendString(node, prop->GetName());
+			AppendVarUInt(node, prop->GetMemberOffset());
+			AppendVarUInt(node, AddType(prop->GetType()));
+		}
+	}
+	break;
+	case SchemaKind::Object:
+	{
+		AppendString(node, schemaType.GetName());
+
+		const auto& baseClassesInfo = schemaType.GetBaseClasses();
+		AppendVarUInt(node, baseClassesInfo.second);
+
+		for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+		{
+			AppendVarUInt(node, AddType(baseClassesInfo.first[i]));
+		}
+
+		const std::size_t propertiesCount = schemaType.GetPropertiesCount();
+		AppendVarUInt(node, propertiesCount);
+
+		for (std::size_t i = 0U; i < propertiesCount; ++i)
+		{
+			rttr::Property* const prop = schemaType.GetProperty(i);
+
+			AppendString(node, prop->GetName());
+			AppendVarUInt(node, AddType(prop->GetType()));
+		}
+
+		AppendVarUInt(node, schemaType.IsCollection() ? AddType(schemaType.GetCollectionItemType()) + 1U : 0U);
+	}
+	break;
+	default:
+		break;
+	}
+
+	m_nodes[nodeIdx] = std::move(node);
+	return nodeIdx;
+}
+
+uint64_t SchemaTableWriter::GetHash(const rttr::Type& type)
+{
+	return m_hasher.GetHash(type);
+}
+
+void SchemaTableWriter::Clear()
+{
+	m_nodeIndices.clear();
+	m_nodes.clear();
+}
+
+void SchemaTableWriter::AppendTable(std::string& buffer) const
+{
+	AppendVarUInt(buffer, m_nodes.size());
+
+	for (const std::string& node : m_nodes)
+	{
+		buffer += node;
+	}
+}
+
+bool SchemaTable::Parse(const char* data, const std::size_t size)
+{
+	m_nodes.clear();
+	m_isParsed = false;
+
+	if (!ParseNodes(data, size))
+	{
+		m_nodes.clear();
+		return false;
+	}
+
+	m_isParsed = true;
+	return true;
+}
+
+bool SchemaTable::ParseNodes(const char* data, const std::size_t size)
+{
+	const char* cursor = data;
+	const char* end = data + size;
+
+	// Every node takes 9 bytes at least
+	uint64_t nodesCount = 0U;
+	if (!ReadVarUInt(cursor, end, nodesCount) || nodesCount > static_cast<uint64_t>(end - cursor) / 9U)
+		return false;
+
+	m_nodes.resize(static_cast<std::size_t>(nodesCount));
+
+	auto readIndex = [&](uint64_t& nodeIdx) {
+		return ReadVarUInt(cursor, end, nodeIdx) && nodeIdx < nodesCount;
+	};
+
+	for (Node& node : m_nodes)
+	{
+		if (end - cursor < 9)
+			return false;
+
+		const uint8_t kind = static_cast<uint8_t>(*cursor++);
+		if (kind >= static_cast<uint8_t>(SchemaKind::Count))
+			return false;
+
+		node.kind = static_cast<SchemaKind>(kind);
+		node.hash = ReadUInt64(cursor);
+		node.size = 0U;
+		node.itemNodeIdx = k_noNode;
+		cursor += 8;
+
+		switch (node.kind)
+		{
+		case SchemaKind::Raw:
+		{
+			if (!ReadVarUInt(cursor, end, node.size))
+				return false;
+		}
+		break;
+		case SchemaKind::Array:
+		{
+			if (!ReadVarUInt(cursor, end, node.size) || !readIndex(node.itemNodeIdx))
+				return false;
+		}
+		break;
+		case SchemaKind::BlittableObject:
+		{
+			uint64_t propertiesCount = 0U;
+			if (!ReadString(cursor, end, node.name) || !ReadVarUInt(cursor, end, node.size) || !ReadVarUInt(cursor, end, propertiesCount) ||
+				propertiesCount > static_cast<uint64_t>(end - cursor))
+				return false;
+
+			node.properties.resize(static_cast<std::size_t>(propertiesCount));
+			for (Property& property : node.properties)
+			{
+				if (!ReadString(cursor, end, property.name) || !ReadVarUInt(cursor, end, property.offset) || !readIndex(property.nodeIdx))
+					return false;
+			}
+		}
+		break;
+		case SchemaKind::Object:
+		{
+			uint64_t basesCount = 0U;
+			if (!ReadString(cursor, end, node.name) || !ReadVarUInt(cursor, end, basesCount) || basesCount > static_cast<uint64_t>(end - cursor))
+				return false;
+
+			node.bases.resize(static_cast<std::size_t>(basesCount));
+			for (uint64_t& baseNodeIdx : node.bases)
+			{
+				if (!readIndex(baseNodeIdx))
+					return false;
+			}
+
+			uint64_t propertiesCount = 0U;
+			if (!ReadVarUInt(cursor, end, propertiesCount) || propertiesCount > static_cast<uint64_t>(end - cursor))
+				return false;
+
+			node.properties.resize(static_cast<std::size_t>(propertiesCount));
+			for (Property& property : node.properties)
+			{
+				property.offset = 0U;
+				if (!ReadString(cursor, end, property.name) || !readIndex(property.nodeIdx))
+					return false;
+			}
+
+			uint64_t itemNodeIdx = 0U;
+			if (!ReadVarUInt(cursor, end, itemNodeIdx) || itemNodeIdx > nodesCount)
+				return false;
+
+			node.itemNodeIdx = (itemNodeIdx != 0U) ? itemNodeIdx - 1U : k_noNode;
+		}
+		break;
+		default:
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool SchemaTable::IsParsed() const
+{
+	return m_isParsed;
+}
+
+const SchemaTable::Node* SchemaTable::GetNode(const uint64_t nodeIdx) const
+{
+	return (nodeIdx < m_nodes.size()) ? &m_nodes[static_cast<std::size_t>(nodeIdx)] : nullptr;
+}
+
+} // namespace binary
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,137 @@
+#pragma once
+#include "rttr/Type.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace rs
+{
+namespace detail
+{
+namespace binary
+{
+
+/*
+* @brief Schema of the binary format values
+*
+* Schema hash is a stable fingerprint of the type layout: meta type and size of scalars, names of objects, their bases,
+* properties names and types, and collection item types. It doesn't depend on registration order or type ids,
+* so it's the same for the same types registration in every process. Only names of user declared types are hashed,
+* types registered implicitly, like STL containers, have compiler specific names and are hashed by structure. Values are written by position when
+* reader type has the same hash, and schema table written along with them is used to match fields by name otherwise.
+*/
+enum class SchemaKind : uint8_t
+{
+	// Can't be skipped without reader type, adapters
+	Opaque,
+	// Bool and 8 bit integers
+	Byte,
+	SignedVarInt,
+	UnsignedVarInt,
+	// Floating point numbers and arrays of blittable values, raw bytes of schema size
+	Raw,
+	String,
+	CString,
+	Pointer,
+	// Array of not blittable items
+	Array,
+	// Raw bytes of object, properties are described with member offsets
+	BlittableObject,
+	Object,
+	Count
+};
+
+// Kind of encoded value of given type, proxy types must be resolved by caller
+SchemaKind GetSchemaKind(const rttr::Type& type);
+
+// Resolves proxy types to their proxy types, as values of proxy types are written as proxies
+rttr::Type GetSchemaType(const rttr::Type& type);
+
+class SchemaHasher
+{
+public:
+	uint64_t GetHash(const rttr::Type& type);
+
+private:
+	uint64_t ComputeHash(const rttr::Type& type);
+
+private:
+	std::unordered_map<rttr::Type, uint64_t> m_hashes;
+	// Types being hashed, types referring to themselves through collections are hashed by name on the second visit
+	std::vector<rttr::Type> m_stack;
+	// Lowest stack position of types hashed by name while hashing the current type
+	std::size_t m_cycleIdx = static_cast<std::size_t>(-1);
+};
+
+/*
+* @brief Writes schema table of all types, which values are written into the archive
+*
+* Table is varint nodes count, then nodes, each node is kind byte, 8 bytes hash, and kind specific data:
+* - Raw: varint size
+* - Array: varint items count, varint item node index
+* - BlittableObject: length prefixed name, varint size, varint properties count, then name, varint offset and node index of each
+* - Object: length prefixed name, varint bases count and base node indices, varint properties count, then name and node index
+* of each, then varint items node index + 1, zero if object isn't a collection
+*/
+class SchemaTableWriter
+{
+public:
+	// Returns node index of the type, adding it and types of its values to the table on first call
+	uint64_t AddType(const rttr::Type& type);
+	uint64_t GetHash(const rttr::Type& type);
+	void Clear();
+	void AppendTable(std::string& buffer) const;
+
+private:
+	std::unordered_map<rttr::Type, uint64_t> m_nodeIndices;
+	std::vector<std::string> m_nodes;
+	SchemaHasher m_hasher;
+};
+
+/*
+* @brief Schema table parsed from archive, see SchemaTableWriter for the layout
+*/
+class SchemaTable
+{
+public:
+	struct Property
+	{
+		std::string_view name;
+		uint64_t offset;
+		uint64_t nodeIdx;
+	};
+
+	struct Node
+	{
+		SchemaKind kind;
+		uint64_t hash;
+		std::string_view name;
+		// Size of raw values, items count of arrays
+		uint64_t size;
+		// Item node of arrays and collections, k_noNode if there are no items
+		uint64_t itemNodeIdx;
+		std::vector<uint64_t> bases;
+		std::vector<Property> properties;
+	};
+
+	static constexpr uint64_t k_noNode = static_cast<uint64_t>(-1);
+
+	// Returns false if table is malformed or references missing nodes
+	bool Parse(const char* data, const std::size_t size);
+	bool IsParsed() const;
+	const Node* GetNode(const uint64_t nodeIdx) const;
+
+private:
+	bool ParseNodes(const char* data, const std::size_t size);
+
+private:
+	std::vector<Node> m_nodes;
+	bool m_isParsed = false;
+};
+
+} // namespace binary
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,62 @@
+#include "rs/ByteOrder.hpp"
+#include "rttr/Type.hpp"
+#include "rttr/Property.hpp"
+
+namespace rs
+{
+
+void SwapBlittableByteOrder(const rttr::Type& type, void* values, const std::size_t count)
+{
+	uint8_t* bytes = static_cast<uint8_t*>(values);
+	const std::size_t size = type.GetSize();
+
+	switch (type.GetTypeClass())
+	{
+	case rttr::TypeClass::Integral:
+	case rttr::TypeClass::Real:
+	{
+		if (size > 1U)
+		{
+			for (std::size_t i = 0U; i < count; ++i)
+			{
+				ByteSwapInPlace(bytes + size * i, size);
+			}
+		}
+	}
+	break;
+	case rttr::TypeClass::Enum:
+	{
+		SwapBlittableByteOrder(type.GetEnumUnderlyingType(), values, count);
+	}
+	break;
+	case rttr::TypeClass::Array:
+	{
+		// Multidimensional arrays are laid out as flat sequence of items
+		std::size_t itemsCount = type.GetArrayExtent(0U);
+		for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+		{
+			itemsCount *= type.GetArrayExtent(i);
+		}
+
+		SwapBlittableByteOrder(type.GetArrayType(), values, count * itemsCount);
+	}
+	break;
+	case rttr::TypeClass::Object:
+	{
+		const std::size_t propertiesCount = type.GetPropertiesCount();
+		for (std::size_t i = 0U; i < count; ++i)
+		{
+			for (std::size_t propertyIdx = 0U; propertyIdx < propertiesCount; ++propertyIdx)
+			{
+				const rttr::Property* property = type.GetProperty(propertyIdx);
+				SwapBlittableByteOrder(property->GetType(), bytes + size * i + property->GetMemberOffset(), 1U);
+			}
+		}
+	}
+	break;
+	default:
+		break;
+	}
+}
+
+} // namespace rs
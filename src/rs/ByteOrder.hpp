@@ -0,0 +1,81 @@
+#pragma once
+#include "raven_serialize_export.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace rttr
+{
+class Type;
+}
+
+namespace rs
+{
+
+enum class ByteOrder : uint8_t
+{
+	LittleEndian,
+	BigEndian
+};
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+constexpr ByteOrder k_hostByteOrder = ByteOrder::BigEndian;
+#else
+constexpr ByteOrder k_hostByteOrder = ByteOrder::LittleEndian;
+#endif
+
+inline uint16_t ByteSwap(const uint16_t value)
+{
+	return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+inline uint32_t ByteSwap(const uint32_t value)
+{
+	return ((value & 0x000000FFU) << 24) | ((value & 0x0000FF00U) << 8) | ((value & 0x00FF0000U) >> 8) | ((value & 0xFF000000U) >> 24);
+}
+
+inline uint64_t ByteSwap(const uint64_t value)
+{
+	return (static_cast<uint64_t>(ByteSwap(static_cast<uint32_t>(value))) << 32) | ByteSwap(static_cast<uint32_t>(value >> 32));
+}
+
+// Reverses bytes of a single scalar value of given size in place, values of other sizes than 2, 4 and 8 are left as is
+inline void ByteSwapInPlace(void* value, const std::size_t size)
+{
+	switch (size)
+	{
+	case 2:
+	{
+		uint16_t bits;
+		std::memcpy(&bits, value, sizeof(bits));
+		bits = ByteSwap(bits);
+		std::memcpy(value, &bits, sizeof(bits));
+	}
+	break;
+	case 4:
+	{
+		uint32_t bits;
+		std::memcpy(&bits, value, sizeof(bits));
+		bits = ByteSwap(bits);
+		std::memcpy(value, &bits, sizeof(bits));
+	}
+	break;
+	case 8:
+	{
+		uint64_t bits;
+		std::memcpy(&bits, value, sizeof(bits));
+		bits = ByteSwap(bits);
+		std::memcpy(value, &bits, sizeof(bits));
+	}
+	break;
+	default:
+		break;
+	}
+}
+
+// Reverses byte order of every numeric field of count consecutive blittable values (see rttr::Type::IsBlittable),
+// so raw bytes written on a host with different byte order become valid values
+void RAVEN_SERIALIZE_API SwapBlittableByteOrder(const rttr::Type& type, void* values, const std::size_t count);
+
+} // namespace rs
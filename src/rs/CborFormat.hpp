@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+
+namespace rs
+{
+namespace detail
+{
+
+/*
+* @brief CBOR (RFC 8949) constants shared by CborWriter and CborParser
+*
+* Documents keep the json readers and writers conventions: objects are maps with property names as keys,
+* bases, collection items, context objects and type ids use the same reserved keys (see SerializationKeywords).
+* Contiguous collections and arrays of numbers are written as RFC 8746 typed arrays: a tag telling item type and
+* byte order, followed by byte string with raw items, so they are copied at once instead of item by item.
+*/
+namespace cbor
+{
+
+// Major types, stored in 3 high bits of initial byte
+constexpr uint8_t k_majorUnsigned = 0U;
+constexpr uint8_t k_majorNegative = 1U;
+constexpr uint8_t k_majorBytes = 2U;
+constexpr uint8_t k_majorText = 3U;
+constexpr uint8_t k_majorArray = 4U;
+constexpr uint8_t k_majorMap = 5U;
+constexpr uint8_t k_majorTag = 6U;
+constexpr uint8_t k_majorSimple = 7U;
+
+// Additional info values, stored in 5 low bits of initial byte
+constexpr uint8_t k_infoMaxImmediate = 23U;
+constexpr uint8_t k_info8 = 24U;
+constexpr uint8_t k_info16 = 25U;
+constexpr uint8_t k_info32 = 26U;
+constexpr uint8_t k_info64 = 27U;
+constexpr uint8_t k_infoIndefinite = 31U;
+
+// Simple values and floats of major type 7
+constexpr uint8_t k_false = 0xF4U;
+constexpr uint8_t k_true = 0xF5U;
+constexpr uint8_t k_null = 0xF6U;
+constexpr uint8_t k_undefined = 0xF7U;
+constexpr uint8_t k_float16 = 0xF9U;
+constexpr uint8_t k_float32 = 0xFAU;
+constexpr uint8_t k_float64 = 0xFBU;
+constexpr uint8_t k_break = 0xFFU;
+
+// RFC 8746 typed array tags are 0b010fsell: float flag, signed flag, little endian flag and item size exponent
+constexpr uint64_t k_typedArrayFirstTag = 64U;
+constexpr uint64_t k_typedArrayLastTag = 87U;
+constexpr uint64_t k_typedArrayFloatFlag = 0x10U;
+constexpr uint64_t k_typedArraySignedFlag = 0x08U;
+constexpr uint64_t k_typedArrayLittleEndianFlag = 0x04U;
+// Uint8 array with clamped arithmetic, items are stored the same way as plain uint8
+constexpr uint64_t k_typedArrayUInt8Clamped = 68U;
+
+} // namespace cbor
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,133 @@
+#pragma once
+#include "rttr/Type.hpp"
+#include "rttr/TypeProxyData.hpp"
+#include "rttr/details/ScalarParams.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace rs
+{
+namespace detail
+{
+
+/*
+* @brief Flat zero-copy format shared by FlatWriter and ValueView
+*
+* Data is laid out as it's going to be accessed, so values are read in place without deserialization.
+* Layout:
+* - Header: magic "RSF", format version, flags (byte order), padding, root value slot, offset of root type name
+* - Blocks, each starting at 8 bytes aligned offset from the buffer start
+*
+* Every value is referenced by 8 bytes slot, slot meaning depends on value meta type:
+* - numbers, enums and bool are stored in the slot itself, as raw bytes in writer byte order
+* - other values are stored in blocks, and slot is absolute block offset, zero means null or missing value
+*
+* Blocks:
+* - strings: 8 bytes length, chars and terminating zero
+* - raw values of blittable objects (see rttr::Type::IsBlittable), they are accessed as C++ objects in place
+* - tables of objects: 8 bytes slots count, then slots of bases, properties and collection items in declaration order
+* - items of arrays and collections without properties: 8 bytes count, then raw items if item type is blittable,
+* or items slots otherwise
+* - pointer records: offset of dynamic type name if it differs from pointed type, and slot of pointed value,
+* each pointed object is written once, so shared and cyclic references are preserved
+*
+* Proxy types are encoded as their proxy values, adapters are not supported and are written as missing values.
+*/
+namespace flat
+{
+
+constexpr char k_magic[3] = { 'R', 'S', 'F' };
+constexpr uint8_t k_version = 1U;
+constexpr std::size_t k_headerSize = 24U;
+constexpr std::size_t k_rootSlotPosition = 8U;
+constexpr std::size_t k_rootTypeNamePosition = 16U;
+
+// Header flags
+constexpr uint8_t k_flagBigEndian = 0x01U;
+
+constexpr std::size_t k_slotSize = 8U;
+constexpr std::size_t k_blockAlignment = 8U;
+constexpr std::size_t k_pointerRecordSize = 16U;
+
+enum class ValueEncoding
+{
+	Unsupported,
+	// Stored in the slot
+	Scalar,
+	String,
+	Raw,
+	Table,
+	Items,
+	Pointer
+};
+
+// Proxy types are encoded as their proxy types, returns invalid type if proxy type isn't set
+inline rttr::Type GetEncodedType(const rttr::Type& type)
+{
+	if (type.GetSerializationMethod() != SerializationMethod::Proxy)
+		return type;
+
+	rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+	return (nullptr != proxyTypeData) ? proxyTypeData->proxyType : rttr::Type();
+}
+
+// Encoding of the value of given encoded type (see GetEncodedType)
+inline ValueEncoding GetValueEncoding(const rttr::Type& type)
+{
+	if (!type.IsValid())
+		return ValueEncoding::Unsupported;
+
+	switch (type.GetPredefinedType())
+	{
+	case PredefinedType::StdString:
+	case PredefinedType::CString:
+		return ValueEncoding::String;
+	default:
+		break;
+	}
+
+	if (type.GetSerializationMethod() != SerializationMethod::Default)
+		return ValueEncoding::Unsupported;
+
+	switch (type.GetTypeClass())
+	{
+	case rttr::TypeClass::Integral:
+	case rttr::TypeClass::Real:
+		return (type.GetNumericKind() != rttr::NumericKind::None) ? ValueEncoding::Scalar : ValueEncoding::Unsupported;
+	case rttr::TypeClass::Enum:
+		return ValueEncoding::Scalar;
+	case rttr::TypeClass::Pointer:
+		return ValueEncoding::Pointer;
+	case rttr::TypeClass::Array:
+		return ValueEncoding::Items;
+	case rttr::TypeClass::Object:
+	{
+		if (type.IsBlittable())
+			return ValueEncoding::Raw;
+
+		// Collections with nothing but items don't need a table
+		if (type.IsCollection() && type.GetPropertiesCount() == 0U && type.GetBaseClasses().second == 0U)
+			return ValueEncoding::Items;
+
+		return ValueEncoding::Table;
+	}
+	default:
+		return ValueEncoding::Unsupported;
+	}
+}
+
+// Raw items are aligned to item alignment, and to slot size at least
+inline std::size_t GetRawAlignment(const rttr::Type& type)
+{
+	return (type.GetAlignment() > k_blockAlignment) ? type.GetAlignment() : k_blockAlignment;
+}
+
+inline std::size_t AlignOffset(const std::size_t offset, const std::size_t alignment)
+{
+	return (offset + alignment - 1U) / alignment * alignment;
+}
+
+} // namespace flat
+} // namespace detail
+} // namespace rs
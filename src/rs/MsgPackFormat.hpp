@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+
+namespace rs
+{
+namespace detail
+{
+
+/*
+* @brief MessagePack format markers shared by MsgPackWriter and MsgPackParser
+*
+* Documents keep the json readers and writers conventions: objects are maps with property names as keys,
+* bases, collection items, context objects and type ids use the same reserved keys (see SerializationKeywords).
+* Multi byte values are big endian, as the format requires.
+*/
+namespace msgpack
+{
+
+constexpr uint8_t k_positiveFixIntMax = 0x7FU;
+constexpr uint8_t k_fixMap = 0x80U;
+constexpr uint8_t k_fixArray = 0x90U;
+constexpr uint8_t k_fixStr = 0xA0U;
+constexpr uint8_t k_nil = 0xC0U;
+constexpr uint8_t k_false = 0xC2U;
+constexpr uint8_t k_true = 0xC3U;
+constexpr uint8_t k_bin8 = 0xC4U;
+constexpr uint8_t k_bin16 = 0xC5U;
+constexpr uint8_t k_bin32 = 0xC6U;
+constexpr uint8_t k_ext8 = 0xC7U;
+constexpr uint8_t k_ext16 = 0xC8U;
+constexpr uint8_t k_ext32 = 0xC9U;
+constexpr uint8_t k_float32 = 0xCAU;
+constexpr uint8_t k_float64 = 0xCBU;
+constexpr uint8_t k_uint8 = 0xCCU;
+constexpr uint8_t k_uint16 = 0xCDU;
+constexpr uint8_t k_uint32 = 0xCEU;
+constexpr uint8_t k_uint64 = 0xCFU;
+constexpr uint8_t k_int8 = 0xD0U;
+constexpr uint8_t k_int16 = 0xD1U;
+constexpr uint8_t k_int32 = 0xD2U;
+constexpr uint8_t k_int64 = 0xD3U;
+constexpr uint8_t k_fixExt1 = 0xD4U;
+constexpr uint8_t k_fixExt16 = 0xD8U;
+constexpr uint8_t k_str8 = 0xD9U;
+constexpr uint8_t k_str16 = 0xDAU;
+constexpr uint8_t k_str32 = 0xDBU;
+constexpr uint8_t k_array16 = 0xDCU;
+constexpr uint8_t k_array32 = 0xDDU;
+constexpr uint8_t k_map16 = 0xDEU;
+constexpr uint8_t k_map32 = 0xDFU;
+constexpr uint8_t k_negativeFixIntMin = 0xE0U;
+
+// Max count or length stored right in the marker byte
+constexpr uint32_t k_fixMapMaxCount = 15U;
+constexpr uint32_t k_fixArrayMaxCount = 15U;
+constexpr uint32_t k_fixStrMaxLength = 31U;
+
+} // namespace msgpack
+} // namespace detail
+} // namespace rs
@@ -0,0 +1,161 @@
+#pragma once
+#include <charconv>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+// Floating point std::to_chars and std::from_chars are missing in some standard libraries, printf with round-trip precision is used then
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#define RS_HAS_FLOAT_TO_CHARS 1
+#else
+#define RS_HAS_FLOAT_TO_CHARS 0
+#endif
+
+namespace rs
+{
+
+namespace detail
+{
+
+// Buffer size enough for any number formatted by functions below
+constexpr std::size_t k_maxNumberLength = 32U;
+
+// Integers are formatted with std::to_chars, without locale or format string parsing
+inline char* FormatNumber(char* buffer, const uint64_t value)
+{
+	return std::to_chars(buffer, buffer + k_maxNumberLength, value).ptr;
+}
+
+inline char* FormatNumber(char* buffer, const int64_t value)
+{
+	return std::to_chars(buffer, buffer + k_maxNumberLength, value).ptr;
+}
+
+// Shortest text, parsed back to exactly the same float, so floats aren't padded with digits of their double widening
+inline char* FormatNumber(char* buffer, const float value)
+{
+#if RS_HAS_FLOAT_TO_CHARS
+	return std::to_chars(buffer, buffer + k_maxNumberLength, value).ptr;
+#else
+	return buffer + std::snprintf(buffer, k_maxNumberLength, "%.9g", static_cast<double>(value));
+#endif
+}
+
+// Shortest text, parsed back to exactly the same double
+inline char* FormatNumber(char* buffer, const double value)
+{
+#if RS_HAS_FLOAT_TO_CHARS
+	return std::to_chars(buffer, buffer + k_maxNumberLength, value).ptr;
+#else
+	return buffer + std::snprintf(buffer, k_maxNumberLength, "%.17g", value);
+#endif
+}
+
+// Double closest to the shortest decimal form of the float, e.g. 0.1 for 0.1f instead of 0.10000000149011612,
+// such double is formatted as short as the float and still converts back to the same float
+inline double WidenFloatShortest(const float value)
+{
+	char buffer[k_maxNumberLength + 1U];
+	char* end = FormatNumber(buffer, value);
+
+#if RS_HAS_FLOAT_TO_CHARS
+	double widenedValue = static_cast<double>(value);
+	std::from_chars(buffer, end, widenedValue);
+	return widenedValue;
+#else
+	*end = '\0';
+	return std::strtod(buffer, nullptr);
+#endif
+}
+
+// Parses real number text with strtod, which needs null terminated text
+inline double ParseRealFallback(const char* begin, const char* end)
+{
+	const std::size_t length = static_cast<std::size_t>(end - begin);
+
+	char localBuffer[64];
+	if (length < sizeof(localBuffer))
+	{
+		std::memcpy(localBuffer, begin, length);
+		localBuffer[length] = '\0';
+		return std::strtod(localBuffer, nullptr);
+	}
+
+	const std::string text(begin, end);
+	return std::strtod(text.c_str(), nullptr);
+}
+
+// Parses json number text straight into the destination type, integers are never parsed through double,
+// and floats are parsed with float rounding. Integer text out of destination range is truncated, as by cast of 64 bit value
+// Returns false if text isn't a number, or if real text isn't finite or doesn't fit integer destination
+template <typename T>
+bool ParseNumber(const char* begin, const char* end, const bool isInteger, T& value)
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+#if RS_HAS_FLOAT_TO_CHARS
+		const std::from_chars_result result = std::from_chars(begin, end, value);
+		if (result.ec == std::errc())
+			return true;
+
+		// Overflow and underflow are resolved to infinity and zero by strtod
+		if (result.ec != std::errc::result_out_of_range)
+			return false;
+#endif
+		value = static_cast<T>(ParseRealFallback(begin, end));
+		return true;
+	}
+	else
+	{
+		if (!isInteger)
+		{
+			// Integers written as reals, like 1e3, are rare, so they take the slow path
+			const double realValue = ParseRealFallback(begin, end);
+
+			const double truncatedValue = std::trunc(realValue);
+
+			// Conversion of real not representable by destination is undefined, limits are checked on reals,
+			// max limit is exclusive, as max + 1 is a power of two and exact in double, while max itself may be not
+			constexpr double minValue = static_cast<double>(std::numeric_limits<T>::min());
+			constexpr double maxValue = static_cast<double>(std::numeric_limits<T>::max() / 2 + 1) * 2.0;
+			if (!std::isfinite(truncatedValue) || truncatedValue < minValue || truncatedValue >= maxValue)
+				return false;
+
+			value = static_cast<T>(truncatedValue);
+			return true;
+		}
+
+		if (std::from_chars(begin, end, value).ec == std::errc())
+			return true;
+
+		// Out of range values and negative values of unsigned types are parsed as 64 bit and truncated
+		if (begin != end && *begin == '-')
+		{
+			int64_t wideValue = 0;
+			if (std::from_chars(begin, end, wideValue).ec != std::errc())
+				return false;
+
+			value = static_cast<T>(wideValue);
+		}
+		else
+		{
+			uint64_t wideValue = 0U;
+			if (std::from_chars(begin, end, wideValue).ec != std::errc())
+				return false;
+
+			value = static_cast<T>(wideValue);
+		}
+
+		return true;
+	}
+}
+
+} // namespace detail
+
+} // namespace rs
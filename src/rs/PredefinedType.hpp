@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+#include <cstdint>
+
+namespace rs
+{
+
+// Types having dedicated representation in serialization formats instead of the type class based one
+// Readers and writers keep handlers for them in tables indexed by this value
+enum class PredefinedType : uint8_t
+{
+	None,
+	StdString,
+	CString,
+
+	Count,
+};
+
+template <typename T>
+struct PredefinedTypeResolver
+{
+	static constexpr PredefinedType value = PredefinedType::None;
+};
+
+template <>
+struct PredefinedTypeResolver<std::string>
+{
+	static constexpr PredefinedType value = PredefinedType::StdString;
+};
+
+template <>
+struct PredefinedTypeResolver<const char*>
+{
+	static constexpr PredefinedType value = PredefinedType::CString;
+};
+
+}
@@ -0,0 +1,359 @@
+#include "rs/View.hpp"
+#include "rs/ByteOrder.hpp"
+#include "rs/log/Log.hpp"
+#include "rttr/Manager.hpp"
+#include "rttr/Property.hpp"
+
+#include <cstdint>
+
+namespace rs
+{
+
+namespace flat = detail::flat;
+
+ValueView::ValueView(const char* buffer, const std::size_t size)
+	: m_buffer(buffer)
+	, m_size(size)
+{}
+
+ValueView ValueView::GetRoot(const rttr::Type& type, const char* data, const std::size_t size)
+{
+	if (nullptr == data || size < flat::k_headerSize || std::memcmp(data, flat::k_magic, sizeof(flat::k_magic)) != 0)
+	{
+		RS_LOG_ERROR("Data isn't flat format data!");
+		return ValueView();
+	}
+
+	if (static_cast<uint8_t>(data[3]) != flat::k_version)
+	{
+		RS_LOG_ERROR("Unsupported flat format version %u!", static_cast<unsigned>(static_cast<uint8_t>(data[3])));
+		return ValueView();
+	}
+
+	// Values are accessed in place, so they can't be converted to other byte order
+	const bool isBigEndian = (static_cast<uint8_t>(data[4]) & flat::k_flagBigEndian) != 0U;
+	if (isBigEndian != (k_hostByteOrder == ByteOrder::BigEndian))
+	{
+		RS_LOG_ERROR("Flat data is written on a host with other byte order!");
+		return ValueView();
+	}
+
+	if (reinterpret_cast<std::uintptr_t>(data) % flat::k_blockAlignment != 0U)
+	{
+		RS_LOG_ERROR("Flat data must be aligned to %u bytes!", static_cast<unsigned>(flat::k_blockAlignment));
+		return ValueView();
+	}
+
+	const ValueView dataView(data, size);
+
+	// Root type name is checked, as values layout is defined by their types
+	const ValueView typeName = dataView.ViewSlot(rttr::Reflect<std::string>(), data + flat::k_rootTypeNamePosition);
+	if (!typeName.IsValid() || typeName.GetString() != type.GetName())
+	{
+		RS_LOG_ERROR("Flat data root value isn't of type '%s'!", type.GetName());
+		return ValueView();
+	}
+
+	return dataView.ViewSlot(type, data + flat::k_rootSlotPosition);
+}
+
+bool ValueView::IsValid() const
+{
+	return nullptr != m_data;
+}
+
+const rttr::Type& ValueView::GetType() const
+{
+	return m_type;
+}
+
+const void* ValueView::GetData() const
+{
+	switch (m_encoding)
+	{
+	case flat::ValueEncoding::Scalar:
+	case flat::ValueEncoding::Raw:
+		return m_data;
+	case flat::ValueEncoding::Items:
+		return m_isInPlaceArray ? m_data : nullptr;
+	default:
+		return nullptr;
+	}
+}
+
+std::string_view ValueView::GetString() const
+{
+	if (m_encoding != flat::ValueEncoding::String)
+		return std::string_view();
+
+	return std::string_view(m_data + flat::k_slotSize, static_cast<std::size_t>(ReadSlot(m_data)));
+}
+
+ValueView ValueView::ViewProperty(std::string_view name) const
+{
+	switch (m_encoding)
+	{
+	case flat::ValueEncoding::Raw:
+	{
+		// Blittable objects have no bases, and all their properties are data members
+		const std::size_t propertyIdx = m_type.FindPropertyIndex(name);
+		if (propertyIdx == rttr::k_invalidPropertyIndex)
+			return ValueView();
+
+		rttr::Property* property = m_type.GetProperty(propertyIdx);
+		return ViewInPlace(property->GetType(), m_data + property->GetMemberOffset());
+	}
+	case flat::ValueEncoding::Table:
+	{
+		const auto& baseClassesInfo = m_type.GetBaseClasses();
+		const std::size_t propertiesCount = m_type.GetPropertiesCount();
+		const std::size_t slotsCount = static_cast<std::size_t>(ReadSlot(m_data));
+		const char* slots = m_data + flat::k_slotSize;
+
+		// Table must have been written for the same type layout
+		if (slotsCount != baseClassesInfo.second + propertiesCount + (m_type.IsCollection() ? 1U : 0U))
+			return ValueView();
+
+		const std::size_t propertyIdx = m_type.FindPropertyIndex(name);
+		if (propertyIdx != rttr::k_invalidPropertyIndex)
+		{
+			const rttr::Type& propertyType = m_type.GetProperty(propertyIdx)->GetType();
+			return ViewSlot(propertyType, slots + (baseClassesInfo.second + propertyIdx) * flat::k_slotSize);
+		}
+
+		for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+		{
+			const ValueView baseView = ViewSlot(baseClassesInfo.first[i], slots + i * flat::k_slotSize);
+			const ValueView propertyView = baseView.ViewProperty(name);
+
+			if (propertyView.IsValid())
+				return propertyView;
+		}
+
+		return ValueView();
+	}
+	default:
+		return ValueView();
+	}
+}
+
+std::size_t ValueView::GetItemsCount() const
+{
+	const ValueView items = ViewItems();
+	if (!items.IsValid())
+		return 0U;
+
+	if (items.m_isInPlaceArray)
+	{
+		std::size_t totalSize = m_type.GetArrayExtent(0U);
+		for (std::size_t i = 1U; i < m_type.GetArrayRank(); ++i)
+		{
+			totalSize *= m_type.GetArrayExtent(i);
+		}
+
+		return totalSize;
+	}
+
+	return static_cast<std::size_t>(ReadSlot(items.m_data));
+}
+
+ValueView ValueView::ViewItem(const std::size_t index) const
+{
+	const ValueView items = ViewItems();
+	if (!items.IsValid() || index >= GetItemsCount())
+		return ValueView();
+
+	const rttr::Type itemType = items.GetItemType();
+	const char* itemsBegin = items.GetItemsBegin();
+
+	if (itemType.IsBlittable())
+		return ViewInPlace(itemType, itemsBegin + index * itemType.GetSize());
+
+	return ViewSlot(itemType, itemsBegin + index * flat::k_slotSize);
+}
+
+const void* ValueView::GetItemsData() const
+{
+	const ValueView items = ViewItems();
+	if (!items.IsValid() || !items.GetItemType().IsBlittable())
+		return nullptr;
+
+	return items.GetItemsBegin();
+}
+
+ValueView ValueView::Dereference() const
+{
+	if (m_encoding != flat::ValueEncoding::Pointer)
+		return ValueView();
+
+	rttr::Type pointedType = m_type.GetPointedType();
+
+	// Dynamic type name is written for polymorphic objects, it's used only if it names type derived from pointed one
+	const uint64_t typeNameOffset = ReadSlot(m_data);
+	if (typeNameOffset != 0U)
+	{
+		const ValueView typeName = ViewBlock(rttr::Type(), flat::ValueEncoding::String, typeNameOffset);
+		if (typeName.IsValid())
+		{
+			// Strings are zero terminated in place, so no copy is needed to look the type up
+			const rttr::Type dynamicType = rttr::Reflect(typeName.m_data + flat::k_slotSize);
+			if (dynamicType.IsValid() && dynamicType.IsBaseClass(pointedType))
+			{
+				pointedType = dynamicType;
+			}
+		}
+	}
+
+	return ViewSlot(pointedType, m_data + flat::k_slotSize);
+}
+
+ValueView ValueView::ViewInPlace(const rttr::Type& type, const char* data) const
+{
+	ValueView view(m_buffer, m_size);
+	view.m_type = type;
+	view.m_data = data;
+	view.m_encoding = flat::GetValueEncoding(type);
+	view.m_isInPlaceArray = (view.m_encoding == flat::ValueEncoding::Items);
+
+	return view;
+}
+
+ValueView ValueView::ViewSlot(const rttr::Type& type, const char* slot) const
+{
+	const rttr::Type encodedType = flat::GetEncodedType(type);
+	const flat::ValueEncoding encoding = flat::GetValueEncoding(encodedType);
+
+	switch (encoding)
+	{
+	case flat::ValueEncoding::Unsupported:
+		return ValueView();
+	case flat::ValueEncoding::Scalar:
+		return ViewInPlace(encodedType, slot);
+	default:
+		return ViewBlock(encodedType, encoding, ReadSlot(slot));
+	}
+}
+
+ValueView ValueView::ViewBlock(const rttr::Type& type, const flat::ValueEncoding encoding, const uint64_t offset) const
+{
+	// Zero offset is null value
+	if (offset < flat::k_headerSize || offset >= m_size || offset % flat::k_blockAlignment != 0U)
+		return ValueView();
+
+	const char* block = m_buffer + offset;
+	const std::size_t available = m_size - static_cast<std::size_t>(offset);
+
+	switch (encoding)
+	{
+	case flat::ValueEncoding::String:
+	{
+		if (available < flat::k_slotSize)
+			return ValueView();
+
+		const uint64_t length = ReadSlot(block);
+		if (length >= available - flat::k_slotSize || block[flat::k_slotSize + length] != '\0')
+			return ValueView();
+	}
+	break;
+	case flat::ValueEncoding::Raw:
+	{
+		if (available < type.GetSize())
+			return ValueView();
+	}
+	break;
+	case flat::ValueEncoding::Table:
+	{
+		if (available < flat::k_slotSize || ReadSlot(block) > (available - flat::k_slotSize) / flat::k_slotSize)
+			return ValueView();
+	}
+	break;
+	case flat::ValueEncoding::Items:
+	{
+		if (available < flat::k_slotSize)
+			return ValueView();
+
+		ValueView items(m_buffer, m_size);
+		items.m_type = type;
+		items.m_data = block;
+
+		const rttr::Type itemType = items.GetItemType();
+		if (!itemType.IsValid())
+			return ValueView();
+
+		// Items must fit in data, raw items are aligned after items count
+		const uint64_t itemsCount = ReadSlot(block);
+		const std::size_t itemSize = itemType.IsBlittable() ? itemType.GetSize() : flat::k_slotSize;
+		const std::size_t itemsOffset = static_cast<std::size_t>(items.GetItemsBegin() - m_buffer);
+
+		if (itemSize == 0U || itemsOffset > m_size || itemsCount > (m_size - itemsOffset) / itemSize)
+			return ValueView();
+	}
+	break;
+	case flat::ValueEncoding::Pointer:
+	{
+		if (available < flat::k_pointerRecordSize)
+			return ValueView();
+	}
+	break;
+	default:
+		return ValueView();
+	}
+
+	ValueView view(m_buffer, m_size);
+	view.m_type = type;
+	view.m_data = block;
+	view.m_encoding = encoding;
+
+	return view;
+}
+
+ValueView ValueView::ViewItems() const
+{
+	switch (m_encoding)
+	{
+	case flat::ValueEncoding::Items:
+		return *this;
+	case flat::ValueEncoding::Table:
+	{
+		if (!m_type.IsCollection())
+			return ValueView();
+
+		// Items slot is the last one
+		const std::size_t slotsCount = static_cast<std::size_t>(ReadSlot(m_data));
+		if (slotsCount != m_type.GetBaseClasses().second + m_type.GetPropertiesCount() + 1U)
+			return ValueView();
+
+		return ViewBlock(m_type, flat::ValueEncoding::Items, ReadSlot(m_data + slotsCount * flat::k_slotSize));
+	}
+	default:
+		return ValueView();
+	}
+}
+
+const char* ValueView::GetItemsBegin() const
+{
+	if (m_isInPlaceArray)
+		return m_data;
+
+	const rttr::Type itemType = GetItemType();
+	if (!itemType.IsBlittable())
+		return m_data + flat::k_slotSize;
+
+	const std::size_t itemsOffset = flat::AlignOffset(static_cast<std::size_t>(m_data - m_buffer) + flat::k_slotSize, flat::GetRawAlignment(itemType));
+	return m_buffer + itemsOffset;
+}
+
+rttr::Type ValueView::GetItemType() const
+{
+	return (m_type.GetTypeClass() == rttr::TypeClass::Array) ? m_type.GetArrayType() : m_type.GetCollectionItemType();
+}
+
+uint64_t ValueView::ReadSlot(const char* slot) const
+{
+	uint64_t value;
+	std::memcpy(&value, slot, sizeof(value));
+
+	return value;
+}
+
+} // namespace rs
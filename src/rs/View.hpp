@@ -0,0 +1,223 @@
+#pragma once
+#include "rs/FlatFormat.hpp"
+#include "readers/InputSource.hpp"
+#include "rttr/Type.hpp"
+
+#include <string_view>
+#include <type_traits>
+#include <cstring>
+
+namespace rttr
+{
+template <typename T>
+Type Reflect();
+}
+
+namespace rs
+{
+
+/*
+* @brief Untyped view of a value in flat data, written with FlatWriter
+*
+* View only points into the data, values are read in place, nothing is allocated or instantiated.
+* Offsets are checked when view is created, so corrupted data gives invalid views rather than reads out of data bounds.
+* Proxy types are viewed as their proxy values. Data must outlive all views, and be aligned to 8 bytes at least,
+* as raw values are accessed in place.
+*/
+class ValueView
+{
+public:
+	ValueView() = default;
+
+	// View of the root value, invalid if data isn't flat data of given type, or written on a host with other byte order
+	static RAVEN_SERIALIZE_API ValueView GetRoot(const rttr::Type& type, const char* data, const std::size_t size);
+
+	bool RAVEN_SERIALIZE_API IsValid() const;
+	// Type of the value, it's dynamic type for values viewed by pointers, or proxy type for proxied values
+	RAVEN_SERIALIZE_API const rttr::Type& GetType() const;
+
+	// Value bytes of numbers, enums, blittable objects and arrays stored in place, nullptr for other values
+	RAVEN_SERIALIZE_API const void* GetData() const;
+	RAVEN_SERIALIZE_API std::string_view GetString() const;
+
+	// Object properties, base class properties are looked up as well
+	RAVEN_SERIALIZE_API ValueView ViewProperty(std::string_view name) const;
+
+	// Items of arrays and collections
+	std::size_t RAVEN_SERIALIZE_API GetItemsCount() const;
+	RAVEN_SERIALIZE_API ValueView ViewItem(const std::size_t index) const;
+	// Contiguous items of blittable type, nullptr if items are not blittable
+	RAVEN_SERIALIZE_API const void* GetItemsData() const;
+
+	// View of the pointed value, invalid for null pointers
+	RAVEN_SERIALIZE_API ValueView Dereference() const;
+
+private:
+	ValueView(const char* buffer, const std::size_t size);
+
+	// View of the value stored in place at data, like items of raw arrays or members of blittable objects
+	ValueView ViewInPlace(const rttr::Type& type, const char* data) const;
+	// View of the value referenced by the slot
+	ValueView ViewSlot(const rttr::Type& type, const char* slot) const;
+	// View of the block at offset, block bounds are checked here
+	ValueView ViewBlock(const rttr::Type& type, const detail::flat::ValueEncoding encoding, const uint64_t offset) const;
+	// Items of collections with table are stored in the last table slot
+	ValueView ViewItems() const;
+	const char* GetItemsBegin() const;
+	rttr::Type GetItemType() const;
+	uint64_t ReadSlot(const char* slot) const;
+
+private:
+	const char* m_buffer = nullptr;
+	std::size_t m_size = 0U;
+	rttr::Type m_type;
+	// Value bytes for values stored in place, or block start for others
+	const char* m_data = nullptr;
+	detail::flat::ValueEncoding m_encoding = detail::flat::ValueEncoding::Unsupported;
+	// Array stored in place, as a member of blittable object, items count isn't stored then
+	bool m_isInPlaceArray = false;
+};
+
+namespace detail
+{
+
+// Item type of arrays and collections, void for other types
+template <typename T, typename = void>
+struct ViewItemType
+{
+	using type = void;
+};
+
+template <typename T>
+struct ViewItemType<T, std::enable_if_t<std::is_array_v<T>>>
+{
+	using type = std::remove_all_extents_t<T>;
+};
+
+template <typename T>
+struct ViewItemType<T, std::void_t<typename T::value_type>>
+{
+	using type = typename T::value_type;
+};
+
+} // namespace detail
+
+/*
+* @brief Typed view of a value in flat data, see ValueView
+*
+* Typed view is valid only if the value has type T, or a type derived from T. Values of proxied types are viewed
+* with their proxy types, for example View<std::string> for the type with string proxy.
+*/
+template <typename T>
+class View
+{
+public:
+	View() = default;
+	explicit View(const ValueView& view)
+		: m_view(IsViewOf(view) ? view : ValueView())
+	{}
+
+	static View GetRoot(const char* data, const std::size_t size)
+	{
+		return View(ValueView::GetRoot(rttr::Reflect<T>(), data, size));
+	}
+
+	// Source, like MappedFileInputSource, must outlive the view
+	static View GetRoot(const InputSource& source)
+	{
+		return source.IsOk() ? GetRoot(source.GetData(), source.GetSize()) : View();
+	}
+
+	bool IsValid() const
+	{
+		return m_view.IsValid();
+	}
+
+	const ValueView& GetValueView() const
+	{
+		return m_view;
+	}
+
+	template <typename PropertyT>
+	View<PropertyT> ViewProperty(std::string_view name) const
+	{
+		return View<PropertyT>(m_view.ViewProperty(name));
+	}
+
+	ValueView ViewProperty(std::string_view name) const
+	{
+		return m_view.ViewProperty(name);
+	}
+
+	// Views the same value as derived type, invalid if value isn't of that type
+	template <typename DerivedT>
+	View<DerivedT> As() const
+	{
+		return View<DerivedT>(m_view);
+	}
+
+	// Numbers, enums and bool, default value for invalid view
+	template <typename U = T, typename = std::enable_if_t<std::is_arithmetic_v<U> || std::is_enum_v<U>>>
+	U GetValue() const
+	{
+		U value{};
+
+		const void* data = m_view.GetData();
+		if (nullptr != data)
+		{
+			std::memcpy(&value, data, sizeof(U));
+		}
+
+		return value;
+	}
+
+	std::string_view GetString() const
+	{
+		return m_view.GetString();
+	}
+
+	// Blittable object in place, nullptr for other types
+	const T* GetData() const
+	{
+		return static_cast<const T*>(m_view.GetData());
+	}
+
+	std::size_t GetItemsCount() const
+	{
+		return m_view.GetItemsCount();
+	}
+
+	template <typename U = T>
+	View<typename detail::ViewItemType<U>::type> operator[](const std::size_t index) const
+	{
+		return View<typename detail::ViewItemType<U>::type>(m_view.ViewItem(index));
+	}
+
+	// Contiguous items of blittable type, nullptr for other item types
+	template <typename U = T>
+	const typename detail::ViewItemType<U>::type* GetItemsData() const
+	{
+		return static_cast<const typename detail::ViewItemType<U>::type*>(m_view.GetItemsData());
+	}
+
+	template <typename U = T, typename = std::enable_if_t<std::is_pointer_v<U>>>
+	View<std::remove_pointer_t<U>> Dereference() const
+	{
+		return View<std::remove_pointer_t<U>>(m_view.Dereference());
+	}
+
+private:
+	static bool IsViewOf(const ValueView& view)
+	{
+		if (!view.IsValid())
+			return false;
+
+		const rttr::Type type = detail::flat::GetEncodedType(rttr::Reflect<T>());
+		return type.IsValid() && (view.GetType() == type || view.GetType().IsBaseClass(type));
+	}
+
+private:
+	ValueView m_view;
+};
+
+} // namespace rs
@@ -3,57 +3,97 @@
 
 #include <memory>
 #include <cstdarg>
-#include <cstring>
+#include <cstdio>
 
 namespace rs
 {
 
-std::vector<ILogger*> Log::s_loggers;
+std::vector<std::pair<ILogger*, LogLevel>> Log::s_loggers;
+LogLevel Log::s_enabledLevel = LogLevel::None;
 bool Log::s_isEnabled = true;
 
-void Log::AddLogger(ILogger* logger)
+void Log::AddLogger(ILogger* logger, const LogLevel minLevel)
 {
-	s_loggers.push_back(logger);
+	s_loggers.emplace_back(logger, minLevel);
+	UpdateEnabledLevel();
+}
+
+void Log::LogMessage(const LogLevel level, const char* format, ...)
+{
+	if (!IsEnabled(level))
+		return;
+
+	va_list args;
+	va_start(args, format);
+	LogFormatted(level, format, args);
+	va_end(args);
 }
 
 void Log::LogMessage(std::string format, ...)
 {
-	if (!s_isEnabled)
+	if (!IsEnabled(LogLevel::Info))
 		return;
 
-	std::string msg;
+	va_list args;
+	va_start(args, format);
+	LogFormatted(LogLevel::Info, format.c_str(), args);
+	va_end(args);
+}
 
-	if (!format.empty())
-	{
-		int final_n, n = ((int)format.size()) * 2; /* Reserve two times as much as the length of the fmt_str */
-		std::unique_ptr<char[]> formatted;
-		va_list ap;
+void Log::LogFormatted(const LogLevel level, const char* format, va_list args)
+{
+	// Most messages fit in stack buffer, heap is used only for long ones
+	char buffer[512];
+	std::unique_ptr<char[]> heapBuffer;
+	const char* formatted = buffer;
 
-		while (1)
-		{
-			formatted.reset(new char[n]); /* Wrap the plain char array into the unique_ptr */
-			strncpy(&formatted[0], format.c_str(), n);
-			va_start(ap, format);
-			final_n = vsnprintf(&formatted[0], n, format.c_str(), ap);
-			va_end(ap);
-			if (final_n < 0 || final_n >= n)
-				n += abs(final_n - n + 1);
-			else
-				break;
-		}
+	va_list argsCopy;
+	va_copy(argsCopy, args);
+	const int length = vsnprintf(buffer, sizeof(buffer), format, argsCopy);
+	va_end(argsCopy);
+
+	if (length < 0)
+		return;
+
+	if (static_cast<std::size_t>(length) >= sizeof(buffer))
+	{
+		heapBuffer.reset(new char[length + 1]);
+		vsnprintf(heapBuffer.get(), length + 1, format, args);
 
-		msg = std::string(formatted.get());
+		formatted = heapBuffer.get();
 	}
 
-	for (ILogger* logger : s_loggers)
+	const std::string msg(formatted, length);
+
+	for (const auto& logger : s_loggers)
 	{
-		logger->Log(msg);
+		if (level >= logger.second)
+		{
+			logger.first->Log(msg);
+		}
 	}
 }
 
 void Log::Enable(const bool enable)
 {
 	s_isEnabled = enable;
+	UpdateEnabledLevel();
+}
+
+void Log::UpdateEnabledLevel()
+{
+	s_enabledLevel = LogLevel::None;
+
+	if (!s_isEnabled)
+		return;
+
+	for (const auto& logger : s_loggers)
+	{
+		if (logger.second < s_enabledLevel)
+		{
+			s_enabledLevel = logger.second;
+		}
+	}
 }
 
 } // namespace rs
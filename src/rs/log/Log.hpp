@@ -1,21 +1,87 @@
 #pragma once
+#include "raven_serialize_export.h"
 #include "rs/log/ILogger.hpp"
 
 #include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstdarg>
+
+#define RS_LOG_LEVEL_TRACE 0
+#define RS_LOG_LEVEL_DEBUG 1
+#define RS_LOG_LEVEL_INFO 2
+#define RS_LOG_LEVEL_WARNING 3
+#define RS_LOG_LEVEL_ERROR 4
+#define RS_LOG_LEVEL_NONE 5
+
+// Messages below this level are compiled out entirely, release builds drop trace and debug messages by default
+#ifndef RS_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define RS_LOG_MIN_LEVEL RS_LOG_LEVEL_INFO
+#else
+#define RS_LOG_MIN_LEVEL RS_LOG_LEVEL_TRACE
+#endif
+#endif
 
 namespace rs
 {
 
+enum class LogLevel : uint8_t
+{
+	Trace = RS_LOG_LEVEL_TRACE,
+	Debug = RS_LOG_LEVEL_DEBUG,
+	Info = RS_LOG_LEVEL_INFO,
+	Warning = RS_LOG_LEVEL_WARNING,
+	Error = RS_LOG_LEVEL_ERROR,
+	None = RS_LOG_LEVEL_NONE
+};
+
 class Log
 {
 public:
-	static void RAVEN_SERIALIZE_API AddLogger(ILogger* logger);
+	static void RAVEN_SERIALIZE_API AddLogger(ILogger* logger, const LogLevel minLevel = LogLevel::Trace);
+	static void RAVEN_SERIALIZE_API LogMessage(const LogLevel level, const char* format, ...);
+	// Former interface, message is logged at info level
+	[[deprecated("Use LogMessage with log level, or RS_LOG macros")]]
 	static void RAVEN_SERIALIZE_API LogMessage(std::string format, ...);
 	static void RAVEN_SERIALIZE_API Enable(const bool enable);
 
+	// Compile time level filter, level is passed as int, so comparison with zero minimum level isn't reported as always true
+	static constexpr bool IsCompiledIn(const int level)
+	{
+		return RS_LOG_MIN_LEVEL <= level;
+	}
+
+	// True if at least one logger accepts messages of given level, checked before any formatting
+	static bool IsEnabled(const LogLevel level)
+	{
+		return level >= s_enabledLevel;
+	}
+
+private:
+	static void LogFormatted(const LogLevel level, const char* format, va_list args);
+	static void UpdateEnabledLevel();
+
 private:
-	static std::vector<ILogger*> s_loggers;
+	static std::vector<std::pair<ILogger*, LogLevel>> s_loggers;
+	static RAVEN_SERIALIZE_API LogLevel s_enabledLevel;
 	static bool s_isEnabled;
 };
 
 } // namespace rs
+
+#define RS_LOG(level, ...) \
+	do \
+	{ \
+		if (::rs::Log::IsCompiledIn(static_cast<int>(level)) && ::rs::Log::IsEnabled(level)) \
+		{ \
+			::rs::Log::LogMessage(level, __VA_ARGS__); \
+		} \
+	} while (false)
+
+#define RS_LOG_TRACE(...) RS_LOG(::rs::LogLevel::Trace, __VA_ARGS__)
+#define RS_LOG_DEBUG(...) RS_LOG(::rs::LogLevel::Debug, __VA_ARGS__)
+#define RS_LOG_INFO(...) RS_LOG(::rs::LogLevel::Info, __VA_ARGS__)
+#define RS_LOG_WARNING(...) RS_LOG(::rs::LogLevel::Warning, __VA_ARGS__)
+#define RS_LOG_ERROR(...) RS_LOG(::rs::LogLevel::Error, __VA_ARGS__)
@@ -23,9 +23,12 @@ void AssignPointerValue(void* pointerAddress, void* value)
 	*pointerValue = static_cast<uintptr_t*>(value);
 }
 
+std::size_t Manager::s_generation = 0U;
+
 void Manager::InitRTTR()
 {
 	g_managerInstance = new Manager();
+	++s_generation;
 }
 
 void Manager::DestroyRTTR()
@@ -34,6 +37,7 @@ void Manager::DestroyRTTR()
 	{
 		delete g_managerInstance;
 		g_managerInstance = nullptr;
+		++s_generation;
 	}
 }
 
@@ -66,47 +70,35 @@ Type Manager::GetMetaTypeByTypeIndex(const std::type_index& typeIndex)
 
 void Manager::RegisterProxyType(const Type& type, const Type& proxyType)
 {
-	m_proxyTypes.emplace(type, std::make_unique<TypeProxyData>(proxyType));
-	m_customSerializationTypes[type.GetId()] = rs::SerializationMethod::Proxy;
+	auto it = m_proxyTypes.emplace(type, std::make_unique<TypeProxyData>(proxyType)).first;
+
+	// Manager owns proxy data, type codec slot only caches it
+	type.m_typeData->proxyData = it->second.get();
+	type.m_typeData->serializationMethod = rs::SerializationMethod::Proxy;
 }
 
 TypeProxyData* Manager::GetProxyType(const Type& type)
 {
-	auto it = m_proxyTypes.find(type);
-	if (it != m_proxyTypes.end())
-	{
-		return it->second.get();
-	}
-
-	return nullptr;
+	return type.m_typeData->proxyData;
 }
 
 void Manager::RegisterSerializationAdapter(const Type& type, std::unique_ptr<rs::SerializationAdapter>&& adapter)
 {
-	m_serializationAdapters.emplace(type, std::move(adapter));
-	m_customSerializationTypes[type.GetId()] = rs::SerializationMethod::Adapter;
+	auto it = m_serializationAdapters.emplace(type, std::move(adapter)).first;
+
+	// Manager owns adapter, type codec slot only caches it
+	type.m_typeData->serializationAdapter = it->second.get();
+	type.m_typeData->serializationMethod = rs::SerializationMethod::Adapter;
 }
 
 rs::SerializationAdapter* Manager::GetSerializationAdapter(const Type& type)
 {
-	auto it = m_serializationAdapters.find(type);
-	if (it != m_serializationAdapters.end())
-	{
-		return it->second.get();
-	}
-
-	return nullptr;
+	return type.m_typeData->serializationAdapter;
 }
 
 rs::SerializationMethod Manager::GetSerializationMethod(const Type& type) const
 {
-	auto it = m_customSerializationTypes.find(type.GetId());
-	if (it != m_customSerializationTypes.end())
-	{
-		return it->second;
-	}
-
-	return rs::SerializationMethod::Default;
+	return type.m_typeData->serializationMethod;
 }
 
 void Manager::AddTypeDataInternal(const std::type_index& typeIndex, std::unique_ptr<type_data>&& typeData)
@@ -19,6 +19,7 @@
 #include <typeindex>
 #include <type_traits>
 #include <memory>
+#include <new>
 
 namespace rttr
 {
@@ -75,6 +76,41 @@ struct DefaultInstanceDestructor<T[N]>
 	}
 };
 
+// Placement construction is provided only for non array default constructible types
+template <typename T, typename Cond = void>
+struct PlacementConstructorResolver
+{
+	static constexpr MetaTypePlacementConstructor constructor = nullptr;
+	static constexpr MetaTypePlacementDestructor destructor = nullptr;
+};
+
+template <typename T>
+struct PlacementConstructorResolver<T, std::enable_if_t<std::is_default_constructible<T>::value && !std::is_array<T>::value>>
+{
+	using ValueType = std::remove_cv_t<T>;
+
+	static void Construct(void* storage)
+	{
+		::new (storage) ValueType();
+	}
+
+	static void Destruct(void* object)
+	{
+		reinterpret_cast<ValueType*>(object)->~ValueType();
+	}
+
+	static constexpr MetaTypePlacementConstructor constructor = &Construct;
+	static constexpr MetaTypePlacementDestructor destructor = &Destruct;
+};
+
+template <typename T>
+const std::type_info& ResolveDynamicType(const void* object, const void*& mostDerivedObject)
+{
+	const T* typedObject = static_cast<const T*>(object);
+	mostDerivedObject = dynamic_cast<const void*>(typedObject);
+	return typeid(*typedObject);
+}
+
 // Helper function for pointers assignment
 void RAVEN_SERIALIZE_API AssignPointerValue(void* pointerAddress, void* value);
 
@@ -140,12 +176,14 @@ public:
 			m_typeNames.emplace(typeName, typeDataRawPtr);
 
 			FillMetaTypeData<T>(*typeDataRawPtr);
+			typeDataRawPtr->isUserDefined = userDefined;
 			typeDataRawPtr->instanceAllocator = allocator;
 			typeDataRawPtr->instanceDestructor = DefaultInstanceDestructor<T>();
+			SetPlacementConstructor<T, AllocatorT>(*typeDataRawPtr);
 			
 			Type typeWrapper(typeDataRawPtr);
 
-			rs::Log::LogMessage(std::string("Meta type registered: ") + typeDataRawPtr->name);
+			RS_LOG_DEBUG("Meta type registered: %s", typeDataRawPtr->name);
 
 			return typeWrapper;
 		}
@@ -170,18 +208,39 @@ public:
 
 				metaTypeDataPtr->isUserDefined = true;
 				metaTypeDataPtr->instanceAllocator = allocator;
+				SetPlacementConstructor<T, AllocatorT>(*metaTypeDataPtr);
 
-				rs::Log::LogMessage(std::string("Meta type registered: ") + metaTypeDataPtr->name);
+				RS_LOG_DEBUG("Meta type registered: %s", metaTypeDataPtr->name);
 			}
 
 			return Type(metaTypeDataPtr);
 		}
 	}
 
+	template <typename T, typename AllocatorT>
+	void SetPlacementConstructor(type_data& metaTypeData)
+	{
+		// Custom allocator may do more than plain construction, so such types are never constructed in place
+		if (std::is_same<AllocatorT, DefaultInstanceAllocator<T>>::value)
+		{
+			metaTypeData.placementConstructor = PlacementConstructorResolver<T>::constructor;
+			metaTypeData.placementDestructor = PlacementConstructorResolver<T>::destructor;
+		}
+		else
+		{
+			metaTypeData.placementConstructor = nullptr;
+			metaTypeData.placementDestructor = nullptr;
+		}
+	}
+
 	template <typename T>
 	void FillMetaTypeData(type_data& metaTypeData)
 	{
 		metaTypeData.isConst = std::is_const<T>::value;
+		metaTypeData.isTriviallyCopyable = std::is_trivially_copyable<T>::value;
+		metaTypeData.alignment = alignof(T);
+		// Type data is shared by cv-qualified types, as typeid ignores top level cv-qualifiers
+		metaTypeData.predefinedType = rs::PredefinedTypeResolver<std::remove_cv_t<T>>::value;
 
 		switch (metaTypeData.typeClass)
 		{
@@ -208,7 +267,9 @@ public:
 			break;
 		case TypeClass::Real:
 			{
+				ScalarTraitsResolver<T> scalarTraitsResolver;
 				metaTypeData.typeParams.scalar = new ScalarParams();
+				scalarTraitsResolver(*metaTypeData.typeParams.scalar);
 			}
 			break;
 		case TypeClass::Object:
@@ -216,6 +277,11 @@ public:
 				ObjectTraitsResolver<T> objectTraitsResolver;
 				metaTypeData.typeParams.object = new ObjectClassParams();
 				objectTraitsResolver(*metaTypeData.typeParams.object);
+
+				if constexpr (std::is_polymorphic_v<T>)
+				{
+					metaTypeData.dynamicTypeResolver = &ResolveDynamicType<T>;
+				}
 			}
 			break;
 		case TypeClass::Enum:
@@ -250,12 +316,14 @@ public:
 	static void RAVEN_SERIALIZE_API InitRTTR();
 	static void RAVEN_SERIALIZE_API DestroyRTTR();
 
+	// Changed on every InitRTTR/DestroyRTTR, type data cached by Reflect<T>() is valid only within the same generation
+	static RAVEN_SERIALIZE_API std::size_t s_generation;
+
 private:
 	void RAVEN_SERIALIZE_API AddTypeDataInternal(const std::type_index& typeIndex, std::unique_ptr<type_data>&& typeData);
 
 private:
 	std::unordered_map<std::type_index, std::unique_ptr<type_data>> m_types;
-	std::unordered_map<std::size_t, rs::SerializationMethod> m_customSerializationTypes;
 	std::unordered_map<std::string, type_data*> m_typeNames;
 	std::unordered_map<Type, std::unique_ptr<TypeProxyData>> m_proxyTypes;
 	std::unordered_map<Type, std::unique_ptr<rs::SerializationAdapter>> m_serializationAdapters;
@@ -288,10 +356,27 @@ Type MetaType(const char* name, Alloc allocatorObject)
 	return Manager::GetRTTRManager().RegisterMetaType<T, Alloc>(name, allocatorObject, true);
 }
 
+// Per type cache of registered type data, so repeated Reflect<T>() calls skip manager lookup
+template <typename T>
+struct ReflectedTypeCache
+{
+	static inline type_data* typeData = nullptr;
+	static inline std::size_t generation = 0U;
+};
+
 template <typename T>
 Type Reflect()
 {
-	return Manager::GetRTTRManager().RegisterMetaType<T>(nullptr, DefaultInstanceAllocator<T>(), false);
+	using Cache = ReflectedTypeCache<T>;
+
+	if (Cache::generation != Manager::s_generation)
+	{
+		Type type = Manager::GetRTTRManager().RegisterMetaType<T>(nullptr, DefaultInstanceAllocator<T>(), false);
+		Cache::typeData = type.m_typeData;
+		Cache::generation = Manager::s_generation;
+	}
+
+	return Type(Cache::typeData);
 }
 
 Type RAVEN_SERIALIZE_API Reflect(const char* name);
@@ -16,6 +16,9 @@ class ICustomPropertyResolvePolicy;
 namespace rttr
 {
 
+// Returned by properties not backed by a data member at fixed offset
+constexpr std::size_t k_invalidMemberOffset = static_cast<std::size_t>(-1);
+
 ///////////////////////////////////////////////////////////////////////////////////////
 
 class Property
@@ -33,6 +36,12 @@ public:
 	virtual bool NeedsTempVariable() const = 0;
 	virtual bool IsCustom() const = 0;
 
+	// Byte offset of data member inside of the object, describes object layout for raw copies
+	virtual std::size_t GetMemberOffset() const
+	{
+		return k_invalidMemberOffset;
+	}
+
 	const Type& GetType() const
 	{
 		return m_type;
@@ -58,7 +67,15 @@ public:
 	MemberProperty(const char* name, SignatureType signature, const Type& type)
 		: Property(name, type)
 		, m_signature(signature)
-	{}
+	{
+		// Offset is only needed for trivially copyable classes, and only reliable for them, as they have no virtual bases
+		if constexpr (std::is_member_object_pointer_v<SignatureType> && std::is_trivially_copyable_v<ClassType>)
+		{
+			alignas(ClassType) unsigned char storage[sizeof(ClassType)];
+			const ClassType* object = reinterpret_cast<const ClassType*>(storage);
+			m_memberOffset = static_cast<std::size_t>(reinterpret_cast<const unsigned char*>(&(object->*m_signature)) - storage);
+		}
+	}
 
 	void SetValue(ClassType* object, ValueType* value) const
 	{
@@ -115,8 +132,14 @@ public:
 		return false;
 	}
 
+	std::size_t GetMemberOffset() const final
+	{
+		return m_memberOffset;
+	}
+
 private:
 	SignatureType m_signature;
+	std::size_t m_memberOffset = k_invalidMemberOffset;
 };
 
 template <typename ClassType, typename ValueType, typename GetterSignature, typename SetterSignature>
@@ -17,8 +17,9 @@ struct GenericTypeSpecializer<std::pair<T, U>>
 		auto keyProperty = CreateMemberProperty("key", &PairT::first);
 		auto valProperty = CreateMemberProperty("val", &PairT::second);
 
-		typeData.typeParams.object->properties.push_back(std::move(keyProperty));
-		typeData.typeParams.object->properties.push_back(std::move(valProperty));
+		Type pairType(&typeData);
+		pairType.AddProperty(std::move(keyProperty));
+		pairType.AddProperty(std::move(valProperty));
 	}
 };
 
@@ -7,17 +7,21 @@
 #include "rttr/details/ScalarParams.hpp"
 #include "rttr/details/EnumParams.hpp"
 
+#include <algorithm>
+
 namespace rttr
 {
 
 type_data::type_data(const TypeClass typeClass, const char* name
 	, const std::size_t id, const std::size_t size, const std::type_index& typeIndex) noexcept
-	: name(name)
+	: typeClass(typeClass)
+	, name(name)
 	, id(id)
 	, size(size)
 	, typeIndex(typeIndex)
+	, isConst(false)
 	, isUserDefined(false)
-	, typeClass(typeClass)
+	, isTriviallyCopyable(false)
 {}
 
 type_data::type_data(type_data&& other)
@@ -26,21 +30,26 @@ type_data::type_data(type_data&& other)
 	, id(other.id)
 	, size(other.size)
 	, typeIndex(other.typeIndex)
-	, isConst(other.isConst)
-	, isUserDefined(other.isUserDefined)
 	, instanceAllocator(other.instanceAllocator)
 	, instanceDestructor(other.instanceDestructor)
+	, placementConstructor(other.placementConstructor)
+	, placementDestructor(other.placementDestructor)
+	, alignment(other.alignment)
+	, dynamicTypeResolver(other.dynamicTypeResolver)
+	, isConst(other.isConst)
+	, isUserDefined(other.isUserDefined)
+	, isTriviallyCopyable(other.isTriviallyCopyable)
 	, debugValueViewer(other.debugValueViewer)
+	, serializationMethod(other.serializationMethod)
+	, predefinedType(other.predefinedType)
+	, proxyData(other.proxyData)
+	, serializationAdapter(other.serializationAdapter)
 {}
 
 Type::Type()
 	: m_typeData(nullptr)
 {}
 
-Type::Type(type_data* typeData)
-	: m_typeData(typeData)
-{}
-
 const bool Type::IsValid() const
 {
 	return nullptr != m_typeData;
@@ -91,6 +100,104 @@ bool Type::IsPolymorphic() const
 	return false;
 }
 
+bool Type::IsTriviallyCopyable() const
+{
+	return m_typeData->isTriviallyCopyable;
+}
+
+bool Type::IsUserDefined() const
+{
+	return m_typeData->isUserDefined;
+}
+
+Type Type::GetDynamicType(const void* object, const void*& mostDerivedObject) const
+{
+	mostDerivedObject = object;
+
+	if (nullptr != m_typeData->dynamicTypeResolver && nullptr != object)
+	{
+		const void* resolvedObject = nullptr;
+		Type dynamicType = Manager::GetRTTRManager().GetMetaTypeByTypeIndex(m_typeData->dynamicTypeResolver(object, resolvedObject));
+
+		if (dynamicType.IsValid())
+		{
+			mostDerivedObject = resolvedObject;
+			return dynamicType;
+		}
+	}
+
+	return *this;
+}
+
+bool Type::IsBlittable() const
+{
+	if (!m_typeData->isTriviallyCopyable || m_typeData->serializationMethod != rs::SerializationMethod::Default)
+		return false;
+
+	switch (m_typeData->typeClass)
+	{
+	case TypeClass::Integral:
+	case TypeClass::Real:
+		// Bool has invalid byte values, so bools read from input must be normalized one by one
+		return GetNumericKind() != NumericKind::None && GetNumericKind() != NumericKind::Bool;
+	case TypeClass::Enum:
+		return GetEnumUnderlyingType().IsBlittable();
+	case TypeClass::Array:
+		return GetArrayType().IsBlittable();
+	case TypeClass::Object:
+		break;
+	default:
+		return false;
+	}
+
+	ObjectClassParams* objectParams = m_typeData->typeParams.object;
+	if (objectParams->blitState == BlitState::Unknown)
+	{
+		objectParams->blitState = BlitState::NotBlittable;
+
+		if (!objectParams->isPolymorphic && !objectParams->collectionParams && m_typeData->basesCount == 0U && !objectParams->properties.empty())
+		{
+			// Properties must be data members which don't overlap and cover all object bytes, so there is no padding or hidden state
+			std::vector<std::pair<std::size_t, std::size_t>> memberRanges;
+			memberRanges.reserve(objectParams->properties.size());
+
+			bool allMembersBlittable = true;
+			for (const std::unique_ptr<Property>& property : objectParams->properties)
+			{
+				const std::size_t offset = property->GetMemberOffset();
+				if (offset == k_invalidMemberOffset || !property->GetType().IsBlittable())
+				{
+					allMembersBlittable = false;
+					break;
+				}
+
+				memberRanges.emplace_back(offset, property->GetType().GetSize());
+			}
+
+			if (allMembersBlittable)
+			{
+				std::sort(memberRanges.begin(), memberRanges.end());
+
+				std::size_t coveredBytes = 0U;
+				for (const auto& memberRange : memberRanges)
+				{
+					if (memberRange.first != coveredBytes)
+						break;
+
+					coveredBytes += memberRange.second;
+				}
+
+				if (coveredBytes == m_typeData->size)
+				{
+					objectParams->blitState = BlitState::Blittable;
+				}
+			}
+		}
+	}
+
+	return objectParams->blitState == BlitState::Blittable;
+}
+
 const std::size_t Type::GetArrayRank() const
 {
 	assert(m_typeData->typeClass == TypeClass::Array);
@@ -127,21 +234,25 @@ Property* Type::GetProperty(const std::size_t propertyIdx) const
 	return m_typeData->typeParams.object->properties[propertyIdx].get();
 }
 
-Property* Type::FindProperty(const std::string& name) const
+Property* Type::FindProperty(std::string_view name) const
 {
 	assert(m_typeData->typeClass == TypeClass::Object);
 
-	for (const auto& property : m_typeData->typeParams.object->properties)
+	const std::size_t propertyIdx = m_typeData->typeParams.object->propertyLookup.Find(name);
+	if (propertyIdx != k_invalidPropertyIndex)
 	{
-		if (property->GetName() == name)
-		{
-			return property.get();
-		}
+		return m_typeData->typeParams.object->properties[propertyIdx].get();
 	}
 
 	return nullptr;
 }
 
+std::size_t Type::FindPropertyIndex(std::string_view name) const
+{
+	assert(m_typeData->typeClass == TypeClass::Object);
+	return m_typeData->typeParams.object->propertyLookup.Find(name);
+}
+
 std::size_t Type::GetPropertiesCount() const
 {
 	assert(m_typeData->typeClass == TypeClass::Object);
@@ -160,7 +271,7 @@ void Type::SetSerializationAdapter(std::unique_ptr<rs::SerializationAdapter>&& a
 
 rs::SerializationAdapter* Type::GetSerializationAdapter() const
 {
-	return Manager::GetRTTRManager().GetSerializationAdapter(Type(m_typeData));
+	return m_typeData->serializationAdapter;
 }
 
 std::pair<Type*, uint8_t> Type::GetBaseClasses() const
@@ -194,6 +305,11 @@ void Type::SetBaseClasses(Type* types, uint8_t count)
 	m_typeData->bases = new Type[count];
 	m_typeData->basesCount = count;
 
+	if (m_typeData->typeClass == TypeClass::Object)
+	{
+		m_typeData->typeParams.object->referenceState = ReferenceState::Unknown;
+	}
+
 	for (uint8_t i = 0U; i < count; ++i)
 	{
 		m_typeData->bases[i] = types[i];
@@ -207,16 +323,14 @@ void Type::AddProperty(std::unique_ptr<Property>&& property)
 	if (!property)
 		return;
 
-	auto predicate = [&property](const std::unique_ptr<Property>& item)
-	{
-		return item->GetName() == property->GetName();
-	};
-
-	auto& properties = m_typeData->typeParams.object->properties;
-	auto it = std::find_if(properties.begin(), properties.end(), predicate);
-	assert(it == properties.end());
+	ObjectClassParams* objectParams = m_typeData->typeParams.object;
+	assert(objectParams->propertyLookup.Find(property->GetName()) == k_invalidPropertyIndex);
 
-	properties.emplace_back(std::move(property));
+	// Name lookup table is filled at declaration time, so readers can dispatch members by name in O(1)
+	objectParams->propertyLookup.Insert(property->GetName(), objectParams->properties.size());
+	objectParams->properties.emplace_back(std::move(property));
+	objectParams->blitState = BlitState::Unknown;
+	objectParams->referenceState = ReferenceState::Unknown;
 }
 
 bool Type::IsCollection() const
@@ -273,6 +387,48 @@ Type Type::GetCollectionItemType() const
 	return Type();
 }
 
+bool Type::CanReserveCollection() const
+{
+	assert(m_typeData->typeClass == TypeClass::Object);
+
+	return m_typeData->typeParams.object->collectionParams && m_typeData->typeParams.object->collectionParams->reserve != &CollectionResizeNoop;
+}
+
+void Type::ReserveCollection(void* collection, const std::size_t newItemsCount) const
+{
+	assert(m_typeData->typeClass == TypeClass::Object);
+
+	if (m_typeData->typeParams.object->collectionParams)
+	{
+		m_typeData->typeParams.object->collectionParams->reserve(collection, newItemsCount);
+	}
+}
+
+bool Type::IsContiguousCollection() const
+{
+	assert(m_typeData->typeClass == TypeClass::Object);
+
+	return m_typeData->typeParams.object->collectionParams && nullptr != m_typeData->typeParams.object->collectionParams->appendItems;
+}
+
+void* Type::AppendCollectionItems(void* collection, const std::size_t count) const
+{
+	assert(IsContiguousCollection());
+	return m_typeData->typeParams.object->collectionParams->appendItems(collection, count);
+}
+
+void Type::RemoveCollectionItems(void* collection, const std::size_t count) const
+{
+	assert(IsContiguousCollection());
+	m_typeData->typeParams.object->collectionParams->removeItems(collection, count);
+}
+
+const void* Type::GetCollectionItemsData(const void* collection, std::size_t& count) const
+{
+	assert(IsContiguousCollection());
+	return m_typeData->typeParams.object->collectionParams->itemsData(collection, count);
+}
+
 uint64_t Type::CastToUnsignedInteger(const void* valuePtr) const
 {
 	assert(m_typeData->typeClass == TypeClass::Integral);
@@ -332,6 +488,21 @@ bool Type::IsSignedIntegral() const
 	return m_typeData->typeParams.scalar->isSigned;
 }
 
+NumericKind Type::GetNumericKind() const
+{
+	if (m_typeData->typeClass == TypeClass::Integral || m_typeData->typeClass == TypeClass::Real)
+	{
+		return m_typeData->typeParams.scalar->numericKind;
+	}
+
+	return NumericKind::None;
+}
+
+bool Type::IsPlainNumeric() const
+{
+	return GetNumericKind() != NumericKind::None && m_typeData->serializationMethod == rs::SerializationMethod::Default;
+}
+
 void* Type::Instantiate() const
 {
 	return std::invoke(m_typeData->instanceAllocator);
@@ -342,6 +513,26 @@ void Type::Destroy(void* object) const
 	std::invoke(m_typeData->instanceDestructor, object);
 }
 
+bool Type::CanConstructInPlace() const
+{
+	return nullptr != m_typeData->placementConstructor;
+}
+
+std::size_t Type::GetAlignment() const
+{
+	return m_typeData->alignment;
+}
+
+void Type::ConstructInPlace(void* storage) const
+{
+	m_typeData->placementConstructor(storage);
+}
+
+void Type::DestroyInPlace(void* object) const
+{
+	m_typeData->placementDestructor(object);
+}
+
 bool Type::operator==(const Type& other) const
 {
 	return m_typeData == other.m_typeData;
@@ -359,7 +550,7 @@ const void* Type::DebugViewValue(const void* value) const
 
 TypeProxyData* Type::GetProxyType() const
 {
-	return Manager::GetRTTRManager().GetProxyType(Type(m_typeData));
+	return m_typeData->proxyData;
 }
 
 void Type::RegisterProxy(const Type& proxyType)
@@ -367,6 +558,79 @@ void Type::RegisterProxy(const Type& proxyType)
 	Manager::GetRTTRManager().RegisterProxyType(Type(m_typeData), proxyType);
 }
 
+bool Type::CanReferenceObjects() const
+{
+	std::vector<Type> checkedTypes;
+	return CanReferenceObjects(checkedTypes);
+}
+
+bool Type::CanReferenceObjects(std::vector<Type>& checkedTypes) const
+{
+	if (m_typeData->predefinedType != rs::PredefinedType::None)
+		return false;
+
+	switch (m_typeData->serializationMethod)
+	{
+	case rs::SerializationMethod::Adapter:
+		return true;
+	case rs::SerializationMethod::Proxy:
+		return nullptr != m_typeData->proxyData && m_typeData->proxyData->proxyType.IsValid() && m_typeData->proxyData->proxyType.CanReferenceObjects(checkedTypes);
+	default:
+		break;
+	}
+
+	switch (m_typeData->typeClass)
+	{
+	case TypeClass::Pointer:
+		return true;
+	case TypeClass::Array:
+		return GetArrayType().CanReferenceObjects(checkedTypes);
+	case TypeClass::Object:
+		break;
+	default:
+		return false;
+	}
+
+	ObjectClassParams* objectParams = m_typeData->typeParams.object;
+	if (objectParams->referenceState != ReferenceState::Unknown)
+		return objectParams->referenceState == ReferenceState::CanReference;
+
+	// Type is being checked by an outer call already
+	if (std::find(checkedTypes.begin(), checkedTypes.end(), *this) != checkedTypes.end())
+		return false;
+
+	checkedTypes.push_back(*this);
+
+	bool canReference = false;
+	for (uint8_t i = 0U; i < m_typeData->basesCount && !canReference; ++i)
+	{
+		canReference = m_typeData->bases[i].CanReferenceObjects(checkedTypes);
+	}
+
+	for (std::size_t i = 0U; i < objectParams->properties.size() && !canReference; ++i)
+	{
+		canReference = objectParams->properties[i]->GetType().CanReferenceObjects(checkedTypes);
+	}
+
+	if (!canReference && objectParams->collectionParams)
+	{
+		canReference = objectParams->collectionParams->itemType.CanReferenceObjects(checkedTypes);
+	}
+
+	// Nested types may have been checked assuming that types of outer calls don't reference objects,
+	// so only positive result is certain for them, and negative result is cached for the outermost type only
+	if (canReference)
+	{
+		objectParams->referenceState = ReferenceState::CanReference;
+	}
+	else if (checkedTypes.front() == *this)
+	{
+		objectParams->referenceState = ReferenceState::NoReferences;
+	}
+
+	return canReference;
+}
+
 std::size_t Type::GetHash() const
 {
 	if (m_typeData)
@@ -379,7 +643,12 @@ std::size_t Type::GetHash() const
 
 rs::SerializationMethod Type::GetSerializationMethod() const
 {
-	return Manager::GetRTTRManager().GetSerializationMethod(Type(m_typeData));
+	return m_typeData->serializationMethod;
+}
+
+rs::PredefinedType Type::GetPredefinedType() const
+{
+	return m_typeData->predefinedType;
 }
 
 } // namespace rttr
@@ -5,10 +5,13 @@
 #include "rttr/TypeClass.hpp"
 #include "rttr/details/CollectionInserter.hpp"
 #include "rttr/details/CollectionIterator.hpp"
+#include "rttr/details/PropertyLookupTable.hpp"
 #include "rs/SerializationMethod.hpp"
+#include "rs/PredefinedType.hpp"
 
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <cassert>
 #include <vector>
@@ -37,6 +40,11 @@ std::unique_ptr<Property> CreateIndirectProperty(const char* name, GetterSignatu
 
 using MetaTypeInstanceAllocator = std::function<void*()>;
 using MetaTypeInstanceDestructor = std::function<void(void*)>;
+// Construct and destroy instance in caller provided storage, used for temp variables arena
+using MetaTypePlacementConstructor = void (*)(void*);
+using MetaTypePlacementDestructor = void (*)(void*);
+// Returns actual type of polymorphic object and address of its most derived object
+using DynamicTypeResolver = const std::type_info& (*)(const void* object, const void*& mostDerivedObject);
 
 template <typename ...Args>
 std::vector<Type> ReflectArgTypes();
@@ -47,6 +55,7 @@ using DebugValueViewer = const void* (*)(const void*);
 struct ObjectClassParams;
 struct PointerParams;
 struct ScalarParams;
+enum class NumericKind : uint8_t;
 struct ArrayParams;
 struct EnumParams;
 
@@ -59,12 +68,25 @@ struct type_data
 	const std::type_index typeIndex;
 	MetaTypeInstanceAllocator instanceAllocator;
 	MetaTypeInstanceDestructor instanceDestructor;
+	// Null if type can't be default constructed in place or has custom instance allocator
+	MetaTypePlacementConstructor placementConstructor = nullptr;
+	MetaTypePlacementDestructor placementDestructor = nullptr;
+	std::size_t alignment = 0U;
+	// Set only for polymorphic class types
+	DynamicTypeResolver dynamicTypeResolver = nullptr;
 	Type* bases = nullptr;
 	uint8_t basesCount = 0U;
 	bool isConst : 1;
 	bool isUserDefined : 1;
+	bool isTriviallyCopyable : 1;
 	DebugValueViewer debugValueViewer = nullptr;
 
+	// Codec slot, serialization behavior resolved at registration time, so readers and writers don't query manager per value
+	rs::SerializationMethod serializationMethod = rs::SerializationMethod::Default;
+	rs::PredefinedType predefinedType = rs::PredefinedType::None;
+	TypeProxyData* proxyData = nullptr;
+	rs::SerializationAdapter* serializationAdapter = nullptr;
+
 	union TypeParams
 	{
 		ObjectClassParams* object;
@@ -86,7 +108,9 @@ class Type
 {
 public:
 	RAVEN_SERIALIZE_API Type();
-	RAVEN_SERIALIZE_API Type(type_data* typeData);
+	Type(type_data* typeData)
+		: m_typeData(typeData)
+	{}
 
 	// Main type parameters
 	RAVEN_SERIALIZE_API const char* GetName() const;
@@ -100,8 +124,22 @@ public:
 	RAVEN_SERIALIZE_API rs::SerializationAdapter* GetSerializationAdapter() const;
 	const bool RAVEN_SERIALIZE_API IsConst() const;
 	bool RAVEN_SERIALIZE_API IsPolymorphic() const;
+	bool RAVEN_SERIALIZE_API IsTriviallyCopyable() const;
+	// Type is declared by user, types registered implicitly, like STL containers, have compiler specific names
+	bool RAVEN_SERIALIZE_API IsUserDefined() const;
+	// Resolves registered type of the most derived object for polymorphic types, for other types returns this type and object itself
+	// If actual type isn't registered, this type is returned as well
+	Type RAVEN_SERIALIZE_API GetDynamicType(const void* object, const void*& mostDerivedObject) const;
+	// Values of blittable type can be copied as raw bytes: type is trivially copyable, has default serialization,
+	// and is a number other than bool, an enum, an array of blittable items, or an object which member properties cover all of its bytes
+	// Result for objects is cached on first call, so it's expected to be called when type registration is complete
+	bool RAVEN_SERIALIZE_API IsBlittable() const;
+	// Values of type may contain pointers, so writers may need to write referenced objects along with them,
+	// adapted types may write any value, so they are assumed to contain pointers. Result for objects is cached like IsBlittable one
+	bool RAVEN_SERIALIZE_API CanReferenceObjects() const;
 	std::size_t RAVEN_SERIALIZE_API GetHash() const;
 	rs::SerializationMethod RAVEN_SERIALIZE_API GetSerializationMethod() const;
+	rs::PredefinedType RAVEN_SERIALIZE_API GetPredefinedType() const;
 
 	const bool RAVEN_SERIALIZE_API IsValid() const;
 	RAVEN_SERIALIZE_API operator bool() const;
@@ -109,16 +147,31 @@ public:
 	// Constructor and destructor
 	RAVEN_SERIALIZE_API void* Instantiate() const;
 	void RAVEN_SERIALIZE_API Destroy(void* object) const;
+	// In place construction, storage must be at least GetSize() bytes with GetAlignment() alignment
+	bool RAVEN_SERIALIZE_API CanConstructInPlace() const;
+	std::size_t RAVEN_SERIALIZE_API GetAlignment() const;
+	void RAVEN_SERIALIZE_API ConstructInPlace(void* storage) const;
+	void RAVEN_SERIALIZE_API DestroyInPlace(void* object) const;
 
 	// Object type class interface
 	RAVEN_SERIALIZE_API Property* GetProperty(const std::size_t propertyIdx) const;
-	RAVEN_SERIALIZE_API Property* FindProperty(const std::string& name) const;
+	RAVEN_SERIALIZE_API Property* FindProperty(std::string_view name) const;
+	// Returns index of property with given name, or k_invalidPropertyIndex if type has no such property
+	std::size_t RAVEN_SERIALIZE_API FindPropertyIndex(std::string_view name) const;
 	std::size_t RAVEN_SERIALIZE_API GetPropertiesCount() const;
 	void RAVEN_SERIALIZE_API AddProperty(std::unique_ptr<Property>&& property);
 	bool RAVEN_SERIALIZE_API IsCollection() const;
 	std::unique_ptr<CollectionInserterBase> RAVEN_SERIALIZE_API CreateCollectionInserter(void* collection) const;
 	std::unique_ptr<CollectionIteratorBase> RAVEN_SERIALIZE_API CreateCollectionIterator(void* collection) const;
 	Type RAVEN_SERIALIZE_API GetCollectionItemType() const;
+	// True if collection can preallocate storage for items, so it's worth to know items count before insertion
+	bool RAVEN_SERIALIZE_API CanReserveCollection() const;
+	void RAVEN_SERIALIZE_API ReserveCollection(void* collection, const std::size_t newItemsCount) const;
+	// Bulk access for contiguous collections of numeric items, see CollectionParams
+	bool RAVEN_SERIALIZE_API IsContiguousCollection() const;
+	RAVEN_SERIALIZE_API void* AppendCollectionItems(void* collection, const std::size_t count) const;
+	void RAVEN_SERIALIZE_API RemoveCollectionItems(void* collection, const std::size_t count) const;
+	RAVEN_SERIALIZE_API const void* GetCollectionItemsData(const void* collection, std::size_t& count) const;
 
 	// Proxy logic
 	void RAVEN_SERIALIZE_API RegisterProxy(const Type& proxyType);
@@ -129,6 +182,10 @@ public:
 	int64_t RAVEN_SERIALIZE_API CastToSignedInteger(const void* value) const;
 	double RAVEN_SERIALIZE_API CastToFloat(const void* value) const;
 	bool RAVEN_SERIALIZE_API IsSignedIntegral() const;
+	// NumericKind::None for non scalar types
+	NumericKind RAVEN_SERIALIZE_API GetNumericKind() const;
+	// Arithmetic type without custom serialization, arrays of such values can be processed in bulk
+	bool RAVEN_SERIALIZE_API IsPlainNumeric() const;
 
 	// Enum type interface
 	Type RAVEN_SERIALIZE_API GetEnumUnderlyingType() const;
@@ -149,6 +206,15 @@ public:
 	RAVEN_SERIALIZE_API const void* DebugViewValue(const void* value) const;
 
 private:
+	// Checked types are collected to stop on types referring to themselves through collections
+	bool CanReferenceObjects(std::vector<Type>& checkedTypes) const;
+
+private:
+	// Manager fills codec slot of type data when custom serialization behavior is registered
+	friend class Manager;
+	template <typename T>
+	friend Type Reflect();
+
 	type_data* m_typeData = nullptr;
 };
 
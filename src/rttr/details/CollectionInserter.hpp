@@ -1,5 +1,8 @@
 #pragma once
 #include <iterator>
+#include <array>
+#include <type_traits>
+#include <utility>
 
 namespace rttr
 {
@@ -8,22 +11,69 @@ struct CollectionInserterBase
 {
 	virtual ~CollectionInserterBase() = default;
 	virtual void Insert(const void* itemObject) = 0;
+	// Inserts item leaving source object in moved-from state
+	virtual void InsertMove(void* itemObject) { Insert(itemObject); }
+
+	// Allows Emplace of up to count items, caller must have reserved collection storage for exactly count more items
+	virtual void SetReservedItemsCount(const std::size_t /*count*/) {}
+	// Default constructs new item inside the collection and returns its address, so item can be read in place
+	// Returns nullptr if collection can't provide stable storage for the item, then item must be inserted from temp object
+	virtual void* Emplace() { return nullptr; }
+	// Removes the item returned by the last Emplace call
+	virtual void CancelEmplace() {}
 };
 
 template <class CollectionT, class ItemT>
 struct CollectionStdBackInserter
 	: public CollectionInserterBase
 {
-	std::back_insert_iterator<CollectionT> m_insertIterator;
+	CollectionT* m_collection;
+	// Items which may still be emplaced, emplaced items must never relocate, as deferred actions may point to them
+	std::size_t m_emplaceBudget = 0U;
 
 	CollectionStdBackInserter(void* collection)
-		: m_insertIterator(std::back_inserter(*static_cast<CollectionT*>(collection)))
+		: m_collection(static_cast<CollectionT*>(collection))
 	{}
 
 	void Insert(const void* itemObject) override
 	{
 		const ItemT* item = static_cast<const ItemT*>(itemObject);
-		m_insertIterator = *item;
+		m_emplaceBudget = 0U;
+		m_collection->push_back(*item);
+	}
+
+	void InsertMove(void* itemObject) override
+	{
+		ItemT* item = static_cast<ItemT*>(itemObject);
+		m_emplaceBudget = 0U;
+		m_collection->push_back(std::move(*item));
+	}
+
+	void SetReservedItemsCount(const std::size_t count) override
+	{
+		m_emplaceBudget = count;
+	}
+
+	void* Emplace() override
+	{
+		// Emplace only within reserved budget, insertions from temps end it, as they don't count against it
+		if constexpr (std::is_default_constructible_v<ItemT> && !std::is_same_v<ItemT, bool>)
+		{
+			if (m_emplaceBudget > 0U && m_collection->size() < m_collection->capacity())
+			{
+				--m_emplaceBudget;
+				m_collection->emplace_back();
+				return &m_collection->back();
+			}
+		}
+
+		return nullptr;
+	}
+
+	void CancelEmplace() override
+	{
+		++m_emplaceBudget;
+		m_collection->pop_back();
 	}
 };
 
@@ -42,6 +92,12 @@ struct CollectionStdInserter
 		const ItemT* item = static_cast<const ItemT*>(itemObject);
 		m_insertIterator = *item;
 	}
+
+	void InsertMove(void* itemObject) override
+	{
+		ItemT* item = static_cast<ItemT*>(itemObject);
+		m_insertIterator = std::move(*item);
+	}
 };
 
 template <class ItemT, std::size_t Size>
@@ -64,6 +120,29 @@ struct StdArrayInserter
 		m_array->at(m_currentIndex) = *item;
 		++m_currentIndex;
 	}
+
+	void InsertMove(void* itemObject) override
+	{
+		ItemT* item = static_cast<ItemT*>(itemObject);
+		m_array->at(m_currentIndex) = std::move(*item);
+		++m_currentIndex;
+	}
+
+	void* Emplace() override
+	{
+		if (m_currentIndex < Size)
+		{
+			return &(*m_array)[m_currentIndex++];
+		}
+
+		return nullptr;
+	}
+
+	void CancelEmplace() override
+	{
+		// Slot is reused by the next item
+		--m_currentIndex;
+	}
 };
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -2,6 +2,8 @@
 #include "rttr/Property.hpp"
 #include "rttr/details/CollectionInserter.hpp"
 #include "rttr/details/CollectionIterator.hpp"
+#include "rttr/details/PropertyLookupTable.hpp"
+#include "rttr/details/ScalarParams.hpp"
 #include <vector>
 #include <unordered_map>
 #include <array>
@@ -12,18 +14,92 @@ namespace rttr
 
 ///////////////////////////////////////////////////////////////////////////////////
 
+// Prepares collection to receive given number of new items, called by readers before insertion when items count is known
+using CollectionReserveFunction = void (*)(void* collection, const std::size_t newItemsCount);
+
+void RAVEN_SERIALIZE_API CollectionResizeNoop(void*, const std::size_t);
+
+template <typename CollectionT>
+void CollectionReserve(void* collection, const std::size_t newItemsCount)
+{
+	CollectionT* collectionPtr = static_cast<CollectionT*>(collection);
+	collectionPtr->reserve(collectionPtr->size() + newItemsCount);
+}
+
+// Direct access to items of contiguous collections with trivially copyable items, so they can be read and written in bulk
+// Append adds count default items and returns address of the first one, or nullptr if collection can't hold them
+using CollectionAppendItemsFunction = void* (*)(void* collection, const std::size_t count);
+// Removes count last items, used to roll back appended items
+using CollectionRemoveItemsFunction = void (*)(void* collection, const std::size_t count);
+using CollectionItemsDataFunction = const void* (*)(const void* collection, std::size_t& count);
+
+template <typename T>
+void* VectorAppendItems(void* collection, const std::size_t count)
+{
+	std::vector<T>* vectorPtr = static_cast<std::vector<T>*>(collection);
+	const std::size_t oldSize = vectorPtr->size();
+	vectorPtr->resize(oldSize + count);
+	return vectorPtr->data() + oldSize;
+}
+
+template <typename T>
+void VectorRemoveItems(void* collection, const std::size_t count)
+{
+	std::vector<T>* vectorPtr = static_cast<std::vector<T>*>(collection);
+	vectorPtr->resize(vectorPtr->size() - count);
+}
+
+template <typename T, std::size_t Size>
+void* StdArrayAppendItems(void* collection, const std::size_t count)
+{
+	// Array inserter always fills array from the start, so do the same here
+	return (count <= Size) ? static_cast<std::array<T, Size>*>(collection)->data() : nullptr;
+}
+
+template <typename CollectionT>
+const void* ContiguousItemsData(const void* collection, std::size_t& count)
+{
+	const CollectionT* collectionPtr = static_cast<const CollectionT*>(collection);
+	count = collectionPtr->size();
+	return collectionPtr->data();
+}
+
 struct CollectionParams
 {
 	std::unique_ptr<CollectionInserterFactory> inserterFactory;
 	std::unique_ptr<CollectionIteratorFactory> iteratorFactory;
+	CollectionReserveFunction reserve = &CollectionResizeNoop;
+	// Set only for contiguous collections of trivially copyable items
+	CollectionAppendItemsFunction appendItems = nullptr;
+	CollectionRemoveItemsFunction removeItems = nullptr;
+	CollectionItemsDataFunction itemsData = nullptr;
 	Type itemType;
 };
 
+enum class BlitState : uint8_t
+{
+	Unknown,
+	Blittable,
+	NotBlittable
+};
+
+enum class ReferenceState : uint8_t
+{
+	Unknown,
+	CanReference,
+	NoReferences
+};
+
 struct ObjectClassParams
 {
 	std::vector<std::unique_ptr<Property>> properties;
+	PropertyLookupTable propertyLookup;
 	std::unique_ptr<CollectionParams> collectionParams;
 	bool isPolymorphic = false;
+	// Cached result of Type::IsBlittable, reset when properties are added
+	BlitState blitState = BlitState::Unknown;
+	// Cached result of Type::CanReferenceObjects, reset when properties or bases are changed
+	ReferenceState referenceState = ReferenceState::Unknown;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +124,16 @@ struct CollectionTraitsResolver<std::vector<T>>
 		auto iteratorFactory = std::make_unique<CollectionIteratorFactoryImpl<std::vector<T>>>();
 		params.collectionParams->iteratorFactory = std::move(iteratorFactory);
 
+		params.collectionParams->reserve = &CollectionReserve<std::vector<T>>;
+
+		// std::vector<bool> is not contiguous
+		if constexpr (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T> && !std::is_same_v<T, bool>)
+		{
+			params.collectionParams->appendItems = &VectorAppendItems<T>;
+			params.collectionParams->removeItems = &VectorRemoveItems<T>;
+			params.collectionParams->itemsData = &ContiguousItemsData<std::vector<T>>;
+		}
+
 		params.collectionParams->itemType = Reflect<T>();
 	}
 };
@@ -63,6 +149,8 @@ struct CollectionTraitsResolver<std::unordered_map<T, U>>
 		auto inserterFactory = std::make_unique<CollectionInserterFactoryImpl<InserterT>>();
 		params.collectionParams->inserterFactory = std::move(inserterFactory);
 
+		params.collectionParams->reserve = &CollectionReserve<std::unordered_map<T, U>>;
+
 		params.collectionParams->itemType = Reflect<std::pair<T, U>>();
 	}
 };
@@ -78,6 +166,13 @@ struct CollectionTraitsResolver<std::array<T, Size>>
 		auto inserterFactory = std::make_unique<CollectionInserterFactoryImpl<InserterT>>();
 		params.collectionParams->inserterFactory = std::move(inserterFactory);
 
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			params.collectionParams->appendItems = &StdArrayAppendItems<T, Size>;
+			params.collectionParams->removeItems = &CollectionResizeNoop;
+			params.collectionParams->itemsData = &ContiguousItemsData<std::array<T, Size>>;
+		}
+
 		params.collectionParams->itemType = Reflect<T>();
 	}
 };
@@ -0,0 +1,104 @@
+#pragma once
+#include <vector>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace rttr
+{
+
+constexpr std::size_t k_invalidPropertyIndex = static_cast<std::size_t>(-1);
+
+/*
+* @brief Open addressing hash table mapping property name to property index
+*
+* Names are hashed with FNV-1a, table is kept at most half full, so lookup is O(1) and usually touches a single slot.
+* Table doesn't own names, declared property names are expected to outlive the type.
+*/
+class PropertyLookupTable
+{
+public:
+	static uint32_t Hash(std::string_view name)
+	{
+		uint32_t hash = 2166136261U;
+		for (const char c : name)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 16777619U;
+		}
+
+		return hash;
+	}
+
+	void Insert(const char* name, const std::size_t propertyIdx)
+	{
+		if ((m_count + 1U) * 2U > m_slots.size())
+		{
+			Grow();
+		}
+
+		InsertSlot(Slot{ name, static_cast<uint32_t>(std::char_traits<char>::length(name)), Hash(name), static_cast<uint32_t>(propertyIdx) });
+		++m_count;
+	}
+
+	std::size_t Find(std::string_view name) const
+	{
+		if (m_slots.empty())
+			return k_invalidPropertyIndex;
+
+		const uint32_t hash = Hash(name);
+		const std::size_t mask = m_slots.size() - 1U;
+
+		for (std::size_t i = hash & mask; ; i = (i + 1U) & mask)
+		{
+			const Slot& slot = m_slots[i];
+			if (nullptr == slot.name)
+				return k_invalidPropertyIndex;
+
+			if (slot.hash == hash && slot.length == name.size() && name.compare(0U, name.size(), slot.name, slot.length) == 0)
+				return slot.propertyIdx;
+		}
+	}
+
+private:
+	struct Slot
+	{
+		const char* name = nullptr;
+		uint32_t length = 0U;
+		uint32_t hash = 0U;
+		uint32_t propertyIdx = 0U;
+	};
+
+	void InsertSlot(const Slot& newSlot)
+	{
+		const std::size_t mask = m_slots.size() - 1U;
+
+		std::size_t i = newSlot.hash & mask;
+		while (nullptr != m_slots[i].name)
+		{
+			i = (i + 1U) & mask;
+		}
+
+		m_slots[i] = newSlot;
+	}
+
+	void Grow()
+	{
+		std::vector<Slot> oldSlots = std::move(m_slots);
+		m_slots.assign(oldSlots.empty() ? 8U : oldSlots.size() * 2U, Slot());
+
+		for (const Slot& slot : oldSlots)
+		{
+			if (nullptr != slot.name)
+			{
+				InsertSlot(slot);
+			}
+		}
+	}
+
+private:
+	std::vector<Slot> m_slots;
+	std::size_t m_count = 0U;
+};
+
+}
@@ -1,11 +1,111 @@
 #pragma once
+#include <type_traits>
+#include <cstdint>
 
 namespace rttr
 {
 
+// Exact machine representation of arithmetic type, lets readers and writers convert whole arrays of such values at once
+enum class NumericKind : uint8_t
+{
+	None,
+	Bool,
+	Int8,
+	UInt8,
+	Int16,
+	UInt16,
+	Int32,
+	UInt32,
+	Int64,
+	UInt64,
+	Float,
+	Double
+};
+
+template <typename T>
+constexpr NumericKind ResolveNumericKind()
+{
+	using ValueType = std::remove_cv_t<T>;
+
+	if constexpr (std::is_same_v<ValueType, bool>)
+	{
+		return NumericKind::Bool;
+	}
+	else if constexpr (std::is_integral_v<ValueType>)
+	{
+		constexpr bool isSigned = std::is_signed_v<ValueType>;
+
+		switch (sizeof(ValueType))
+		{
+		case 1:
+			return isSigned ? NumericKind::Int8 : NumericKind::UInt8;
+		case 2:
+			return isSigned ? NumericKind::Int16 : NumericKind::UInt16;
+		case 4:
+			return isSigned ? NumericKind::Int32 : NumericKind::UInt32;
+		case 8:
+			return isSigned ? NumericKind::Int64 : NumericKind::UInt64;
+		default:
+			return NumericKind::None;
+		}
+	}
+	else if constexpr (std::is_same_v<ValueType, float>)
+	{
+		return NumericKind::Float;
+	}
+	else if constexpr (std::is_same_v<ValueType, double>)
+	{
+		return NumericKind::Double;
+	}
+	else
+	{
+		return NumericKind::None;
+	}
+}
+
+template <typename T>
+struct NumericTypeTag
+{
+	using type = T;
+};
+
+// Calls functor with NumericTypeTag of the C++ type matching numeric kind, returns functor result, or false for NumericKind::None
+template <typename FunctorT>
+bool VisitNumericKind(const NumericKind kind, FunctorT&& functor)
+{
+	switch (kind)
+	{
+	case NumericKind::Bool:
+		return functor(NumericTypeTag<bool>());
+	case NumericKind::Int8:
+		return functor(NumericTypeTag<int8_t>());
+	case NumericKind::UInt8:
+		return functor(NumericTypeTag<uint8_t>());
+	case NumericKind::Int16:
+		return functor(NumericTypeTag<int16_t>());
+	case NumericKind::UInt16:
+		return functor(NumericTypeTag<uint16_t>());
+	case NumericKind::Int32:
+		return functor(NumericTypeTag<int32_t>());
+	case NumericKind::UInt32:
+		return functor(NumericTypeTag<uint32_t>());
+	case NumericKind::Int64:
+		return functor(NumericTypeTag<int64_t>());
+	case NumericKind::UInt64:
+		return functor(NumericTypeTag<uint64_t>());
+	case NumericKind::Float:
+		return functor(NumericTypeTag<float>());
+	case NumericKind::Double:
+		return functor(NumericTypeTag<double>());
+	default:
+		return false;
+	}
+}
+
 struct ScalarParams
 {
 	bool isSigned : 1;
+	NumericKind numericKind = NumericKind::None;
 };
 
 template <typename T, typename Cond = void>
@@ -20,6 +120,17 @@ struct ScalarTraitsResolver<T, std::enable_if_t<std::is_integral_v<T>>>
 	void operator()(ScalarParams& params)
 	{
 		params.isSigned = std::is_signed_v<T>;
+		params.numericKind = ResolveNumericKind<T>();
+	}
+};
+
+template <typename T>
+struct ScalarTraitsResolver<T, std::enable_if_t<std::is_floating_point_v<T>>>
+{
+	void operator()(ScalarParams& params)
+	{
+		params.isSigned = true;
+		params.numericKind = ResolveNumericKind<T>();
 	}
 };
 
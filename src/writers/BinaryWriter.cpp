@@ -0,0 +1,502 @@
+#include "writers/BinaryWriter.hpp"
+#include "rttr/Manager.hpp"
+#include "rttr/Property.hpp"
+#include "rs/BinaryFormat.hpp"
+#include "rs/ByteOrder.hpp"
+#include "rs/log/Log.hpp"
+
+#include <algorithm>
+
+namespace rs
+{
+
+namespace binary = detail::binary;
+
+BinaryWriter::BinaryWriter(const bool writeSchemaTable, const bool writeObjectsIndex)
+	: m_bufferSink(std::make_unique<StringOutputSink>(m_buffer))
+	, m_sink(*m_bufferSink)
+	, m_writeSchemaTable(writeSchemaTable)
+	, m_writeObjectsIndex(writeObjectsIndex)
+{}
+
+BinaryWriter::BinaryWriter(OutputSink& sink, const bool writeSchemaTable, const bool writeObjectsIndex)
+	: m_sink(sink)
+	, m_writeSchemaTable(writeSchemaTable)
+	, m_writeObjectsIndex(writeObjectsIndex)
+{}
+
+const std::string& BinaryWriter::GetBuffer() const
+{
+	return m_buffer;
+}
+
+bool BinaryWriter::Write(const rttr::Type& type, const void* value)
+{
+	if (!type.IsValid() || !value || !m_sink.IsOk())
+		return false;
+
+	if (m_bufferSink)
+	{
+		m_bufferSink->Clear();
+	}
+
+	m_objectIds.clear();
+	m_pendingObjects.clear();
+	m_rootReferenced = false;
+	m_schemaTable.Clear();
+	m_context = std::make_unique<rs::detail::SerializationContext>();
+
+	// Root type is the first schema node
+	m_schemaTable.AddType(type);
+
+	// Root object gets the first id, so pointers back to it are resolved to the master object
+	m_objectIds.emplace(detail::ObjectKey{ value, type }, 1U);
+	m_nextObjectId = 2U;
+
+	// Offsets in objects index are counted from archive start, sink may hold data written before
+	const uint64_t archiveOffset = m_sink.GetWrittenSize();
+	bool isComplete = true;
+
+	if (!m_writeObjectsIndex && !type.CanReferenceObjects())
+	{
+		// Schema table has all types of such value already, so single root value is written straight after it
+		m_out = &m_sink;
+		WriteHeader(type);
+		WriteVarUInt(0U);
+		WriteValue(type, value);
+
+		// Types changed after the root type was checked may reference objects, which can't be written then
+		isComplete = m_pendingObjects.empty() && !m_rootReferenced;
+	}
+	else
+	{
+		m_valueBuffer.Clear();
+		m_out = &m_valueBuffer;
+		WriteValue(type, value);
+
+		if (m_pendingObjects.empty() && !m_rootReferenced && !m_writeObjectsIndex)
+		{
+			// Nothing is referenced, so single root value is enough
+			m_out = &m_sink;
+			WriteHeader(type);
+			WriteVarUInt(0U);
+			m_sink.Append(m_valueBuffer.GetData(), m_valueBuffer.GetSize());
+		}
+		else
+		{
+			// Objects id and offset in objects list
+			std::vector<std::pair<uint64_t, uint64_t>> objectOffsets;
+			uint64_t objectsCount = 1U;
+
+			m_objectsBuffer.Clear();
+			objectOffsets.emplace_back(1U, 0U);
+			AppendObject(1U, nullptr, 0U);
+
+			// Objects may reference other objects, which are queued while writing, so every object is written exactly once
+			while (!m_pendingObjects.empty())
+			{
+				const PendingObject object = m_pendingObjects.front();
+				m_pendingObjects.pop_front();
+
+				m_valueBuffer.Clear();
+				m_out = &m_valueBuffer;
+				WriteValue(object.type, object.value);
+
+				objectOffsets.emplace_back(object.id, m_objectsBuffer.GetSize());
+				AppendObject(object.id, object.writeTypeName ? object.type.GetName() : nullptr, m_schemaTable.AddType(object.type));
+
+				++objectsCount;
+			}
+
+			// Schema table is complete only when all objects are written, as it includes their types
+			m_out = &m_sink;
+			WriteHeader(type);
+			WriteVarUInt(objectsCount);
+			WriteVarUInt(1U);
+
+			const uint64_t objectsOffset = m_sink.GetWrittenSize() - archiveOffset;
+			m_sink.Append(m_objectsBuffer.GetData(), m_objectsBuffer.GetSize());
+
+			if (m_writeObjectsIndex)
+			{
+				WriteObjectsIndex(objectOffsets, objectsOffset, archiveOffset);
+			}
+		}
+	}
+
+	m_out = nullptr;
+	m_context.reset();
+
+	if (!isComplete)
+	{
+		RS_LOG_ERROR("Type '%s' was changed after its first write, referenced objects are not written!", type.GetName());
+		return false;
+	}
+
+	return m_sink.Flush();
+}
+
+void BinaryWriter::WriteHeader(const rttr::Type& type)
+{
+	m_out->Append(binary::k_magic, sizeof(binary::k_magic));
+	m_out->Append(static_cast<char>(binary::k_version));
+	m_out->Append(static_cast<char>((k_hostByteOrder == ByteOrder::BigEndian ? binary::k_flagBigEndian : 0U) |
+		(m_writeObjectsIndex ? binary::k_flagObjectsIndex : 0U)));
+	WriteUInt64(m_schemaTable.GetHash(type));
+
+	m_schemaBuffer.clear();
+	if (m_writeSchemaTable)
+	{
+		m_schemaTable.AppendTable(m_schemaBuffer);
+	}
+
+	WriteVarUInt(m_schemaBuffer.size());
+	m_out->Append(m_schemaBuffer.data(), m_schemaBuffer.size());
+}
+
+void BinaryWriter::AppendObject(const uint64_t objectId, const char* typeName, const uint64_t schemaNodeIdx)
+{
+	m_out = &m_objectsBuffer;
+	WriteVarUInt(objectId);
+
+	if (nullptr != typeName)
+	{
+		WriteString(typeName, std::char_traits<char>::length(typeName));
+	}
+	else
+	{
+		WriteVarUInt(0U);
+	}
+
+	WriteVarUInt(schemaNodeIdx);
+	WriteVarUInt(m_valueBuffer.GetSize());
+	m_objectsBuffer.Append(m_valueBuffer.GetData(), m_valueBuffer.GetSize());
+}
+
+void BinaryWriter::WriteValue(const rttr::Type& type, const void* value)
+{
+	switch (type.GetPredefinedType())
+	{
+	case rs::PredefinedType::StdString:
+	{
+		const std::string& str = *static_cast<const std::string*>(value);
+		WriteString(str.data(), str.size());
+	}
+	return;
+	case rs::PredefinedType::CString:
+	{
+		// Length is shifted by one, so zero is left for null string
+		const char* str = static_cast<const char*>(*reinterpret_cast<const void* const*>(value));
+		if (nullptr == str)
+		{
+			WriteVarUInt(0U);
+		}
+		else
+		{
+			const std::size_t length = std::char_traits<char>::length(str);
+			WriteVarUInt(length + 1U);
+			m_out->Append(str, length);
+		}
+	}
+	return;
+	default:
+		break;
+	}
+
+	switch (type.GetSerializationMethod())
+	{
+	case rs::SerializationMethod::Proxy:
+	{
+		rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+		if (nullptr != proxyTypeData)
+		{
+			WriteProxy(proxyTypeData, value);
+		}
+	}
+	break;
+	case rs::SerializationMethod::Adapter:
+	{
+		SerializationAdapter* adapter = type.GetSerializationAdapter();
+		if (nullptr != adapter)
+		{
+			WriteAdapter(adapter, value);
+		}
+	}
+	break;
+	default:
+	{
+		switch (type.GetTypeClass())
+		{
+		case rttr::TypeClass::Object:
+		{
+			WriteObject(type, value);
+		}
+		break;
+		case rttr::TypeClass::Pointer:
+		{
+			WritePointer(type, value);
+		}
+		break;
+		case rttr::TypeClass::Enum:
+		{
+			WriteValue(type.GetEnumUnderlyingType(), value);
+		}
+		break;
+		case rttr::TypeClass::Real:
+		{
+			m_out->Append(static_cast<const char*>(value), type.GetSize());
+		}
+		break;
+		case rttr::TypeClass::Integral:
+		{
+			WriteIntegral(type, value);
+		}
+		break;
+		case rttr::TypeClass::Array:
+		{
+			WriteArray(type, value);
+		}
+		break;
+		default:
+			break;
+		}
+	}
+	break;
+	}
+}
+
+void BinaryWriter::WriteObject(const rttr::Type& type, const void* value)
+{
+	// Plain data objects are copied as is
+	if (type.IsBlittable())
+	{
+		m_out->Append(static_cast<const char*>(value), type.GetSize());
+		return;
+	}
+
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+	{
+		WriteValue(baseClassesInfo.first[i], value);
+	}
+
+	// Properties are written by position, schema table maps them to names
+	const std::size_t propertiesCount = type.GetPropertiesCount();
+	for (std::size_t i = 0U; i < propertiesCount; ++i)
+	{
+		rttr::Property* const prop = type.GetProperty(i);
+
+		void* propValue = nullptr;
+		bool needRelease = false;
+		prop->GetValue(value, propValue, needRelease);
+
+		WriteValue(prop->GetType(), propValue);
+
+		// Release temp object if required
+		if (needRelease)
+		{
+			prop->GetType().Destroy(propValue);
+		}
+	}
+
+	if (type.IsCollection())
+	{
+		WriteCollection(type, value);
+	}
+}
+
+void BinaryWriter::WriteCollection(const rttr::Type& type, const void* value)
+{
+	const rttr::Type itemType = type.GetCollectionItemType();
+
+	// Contiguous items of plain data are copied at once
+	if (itemType.IsBlittable() && type.IsContiguousCollection())
+	{
+		std::size_t itemsCount = 0U;
+		const void* items = type.GetCollectionItemsData(value, itemsCount);
+
+		WriteVarUInt(itemsCount);
+		m_out->Append(static_cast<const char*>(items), itemsCount * itemType.GetSize());
+		return;
+	}
+
+	std::unique_ptr<rttr::CollectionIteratorBase> it = type.CreateCollectionIterator(const_cast<void*>(value));
+	if (!it)
+	{
+		RS_LOG_ERROR("Collection '%s' can't be iterated, items are not written!", type.GetName());
+		WriteVarUInt(0U);
+		return;
+	}
+
+	// Count is written before items, so iterate twice, it's cheaper than buffering items
+	uint64_t itemsCount = 0U;
+	for (; *it; ++(*it))
+	{
+		++itemsCount;
+	}
+
+	WriteVarUInt(itemsCount);
+
+	for (it = type.CreateCollectionIterator(const_cast<void*>(value)); *it; ++(*it))
+	{
+		WriteValue(itemType, *(*it));
+	}
+}
+
+void BinaryWriter::WritePointer(const rttr::Type& type, const void* value)
+{
+	const void* pointedValue = *static_cast<const void* const*>(value);
+	if (nullptr == pointedValue)
+	{
+		WriteVarUInt(0U);
+		return;
+	}
+
+	// Objects are identified by address of most derived object, so base and derived pointers to it share the id
+	const rttr::Type pointedType = type.GetPointedType();
+	const void* objectValue = nullptr;
+	const rttr::Type objectType = pointedType.GetDynamicType(pointedValue, objectValue);
+
+	WriteVarUInt(GetObjectId(objectType, objectValue, objectType != pointedType));
+}
+
+void BinaryWriter::WriteProxy(rttr::TypeProxyData* proxyTypeData, const void* value)
+{
+	if (proxyTypeData->writeConverter)
+	{
+		void* targetObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+		proxyTypeData->writeConverter->Convert(targetObject, value);
+
+		WriteValue(proxyTypeData->proxyType, targetObject);
+
+		m_context->DestroyTempVariable(targetObject);
+	}
+	else
+	{
+		RS_LOG_ERROR("Type has proxy type, but no write converter defined!");
+	}
+}
+
+void BinaryWriter::WriteAdapter(SerializationAdapter* adapter, const void* value)
+{
+	SerializationAdapter::AdapterWriteOutput adapterOutput = adapter->Write(value);
+
+	const bool hasPayload = adapterOutput.payload.type.IsValid() && adapterOutput.payload.value;
+	const bool hasValue = adapterOutput.value.type.IsValid() && adapterOutput.value.value;
+
+	m_out->Append(static_cast<char>((hasPayload ? binary::k_adapterPayload : 0U) | (hasValue ? binary::k_adapterValue : 0U)));
+
+	// Payload goes first, as reader needs it to know the value type
+	if (hasPayload)
+	{
+		WriteValue(adapterOutput.payload.type, adapterOutput.payload.value);
+	}
+
+	if (hasValue)
+	{
+		WriteValue(adapterOutput.value.type, adapterOutput.value.value);
+	}
+
+	adapter->WriteFinalize(value);
+}
+
+void BinaryWriter::WriteArray(const rttr::Type& type, const void* value)
+{
+	const rttr::Type arrayType = type.GetArrayType();
+	const uint8_t* arrayBytePtr = static_cast<const uint8_t*>(value);
+	const std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	// Arrays of plain data are copied at once
+	if (arrayType.IsBlittable())
+	{
+		m_out->Append(static_cast<const char*>(value), itemSize * totalSize);
+		return;
+	}
+
+	for (std::size_t i = 0U; i < totalSize; i++)
+	{
+		WriteValue(arrayType, arrayBytePtr + itemSize * i);
+	}
+}
+
+void BinaryWriter::WriteIntegral(const rttr::Type& type, const void* value)
+{
+	const std::size_t size = type.GetSize();
+
+	// Single byte values gain nothing from varint encoding
+	if (size == 1U)
+	{
+		m_out->Append(*static_cast<const char*>(value));
+	}
+	else if (type.IsSignedIntegral())
+	{
+		WriteVarUInt(binary::ZigZagEncode(type.CastToSignedInteger(value)));
+	}
+	else
+	{
+		WriteVarUInt(type.CastToUnsignedInteger(value));
+	}
+}
+
+void BinaryWriter::WriteString(const char* str, const std::size_t length)
+{
+	WriteVarUInt(length);
+	m_out->Append(str, length);
+}
+
+void BinaryWriter::WriteObjectsIndex(std::vector<std::pair<uint64_t, uint64_t>>& objectOffsets, const uint64_t objectsOffset, const uint64_t archiveOffset)
+{
+	// Ids are given in writing order, so records are usually sorted already
+	std::sort(objectOffsets.begin(), objectOffsets.end());
+
+	const uint64_t indexOffset = m_out->GetWrittenSize() - archiveOffset;
+
+	for (const auto& objectOffset : objectOffsets)
+	{
+		WriteUInt64(objectOffset.first);
+		WriteUInt64(objectsOffset + objectOffset.second);
+	}
+
+	WriteUInt64(indexOffset);
+}
+
+void BinaryWriter::WriteVarUInt(const uint64_t value)
+{
+	char bytes[binary::k_maxVarUIntSize];
+	m_out->Append(bytes, binary::EncodeVarUInt(bytes, value));
+}
+
+void BinaryWriter::WriteUInt64(const uint64_t value)
+{
+	char bytes[sizeof(uint64_t)];
+	binary::EncodeUInt64(bytes, value);
+	m_out->Append(bytes, sizeof(bytes));
+}
+
+uint64_t BinaryWriter::GetObjectId(const rttr::Type& type, const void* value, const bool writeTypeName)
+{
+	// Objects are keyed by address and type, so each pair gets exactly one id
+	auto insertResult = m_objectIds.emplace(detail::ObjectKey{ value, type }, m_nextObjectId);
+	if (!insertResult.second)
+	{
+		if (insertResult.first->second == 1U)
+		{
+			m_rootReferenced = true;
+		}
+
+		return insertResult.first->second;
+	}
+
+	const uint64_t objectId = m_nextObjectId++;
+	m_pendingObjects.push_back(PendingObject{ objectId, type, value, writeTypeName });
+
+	return objectId;
+}
+
+} // namespace rs
@@ -0,0 +1,92 @@
+#pragma once
+#include "writers/IWriter.hpp"
+#include "writers/OutputSink.hpp"
+#include "SerializationContext.hpp"
+#include "rs/BinarySchema.hpp"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace rs
+{
+
+/*
+* @brief Compact binary writer implementation, see rs/BinaryFormat.hpp for the layout
+*
+* Values are written by their meta type only, without names or tags. Schema hash and schema table of written types are written once
+* per archive, so reader with the same types registration reads values by position, and reader with changed types matches fields by name.
+* Schema table may be omitted for short messages between peers sharing types, such data is read only with the same types.
+* Objects index makes large archives randomly accessible, reader locates any object by id without parsing others.
+* Objects referenced by pointers are written once each into objects list, shared and cyclic references are preserved.
+* Values of types which can't reference objects are encoded straight into the output sink, objects list is collected
+* in a buffer first, as schema table of all written types precedes it.
+*/
+class BinaryWriter
+	: public IWriter
+{
+public:
+	explicit RAVEN_SERIALIZE_API BinaryWriter(const bool writeSchemaTable = true, const bool writeObjectsIndex = false);
+	// Sink is not owned and must outlive the writer
+	explicit RAVEN_SERIALIZE_API BinaryWriter(OutputSink& sink, const bool writeSchemaTable = true, const bool writeObjectsIndex = false);
+	~BinaryWriter() = default;
+
+	bool RAVEN_SERIALIZE_API Write(const rttr::Type& type, const void* value) override;
+	// Serialized data of the last write, empty if writer writes to the sink given on construction
+	RAVEN_SERIALIZE_API const std::string& GetBuffer() const;
+
+private:
+	struct PendingObject
+	{
+		uint64_t id;
+		rttr::Type type;
+		const void* value;
+		// Type name is written only if it differs from the pointer static type
+		bool writeTypeName;
+	};
+
+	void WriteValue(const rttr::Type& type, const void* value);
+	void WriteObject(const rttr::Type& type, const void* value);
+	void WriteCollection(const rttr::Type& type, const void* value);
+	void WritePointer(const rttr::Type& type, const void* value);
+	void WriteProxy(rttr::TypeProxyData* proxyTypeData, const void* value);
+	void WriteAdapter(SerializationAdapter* adapter, const void* value);
+	void WriteArray(const rttr::Type& type, const void* value);
+	void WriteIntegral(const rttr::Type& type, const void* value);
+	void WriteString(const char* str, const std::size_t length);
+	void WriteVarUInt(const uint64_t value);
+	void WriteUInt64(const uint64_t value);
+
+	// Writes header and schema table, table must have all written types
+	void WriteHeader(const rttr::Type& type);
+	// Appends objects list item with value written to value buffer
+	void AppendObject(const uint64_t objectId, const char* typeName, const uint64_t schemaNodeIdx);
+	// Writes objects index records, sorted by id, and index offset
+	void WriteObjectsIndex(std::vector<std::pair<uint64_t, uint64_t>>& objectOffsets, const uint64_t objectsOffset, const uint64_t archiveOffset);
+	// Returns id of the object, registering it in objects list on first reference
+	uint64_t GetObjectId(const rttr::Type& type, const void* value, const bool writeTypeName);
+
+private:
+	std::string m_buffer;
+	// Sink writing to the buffer, if writer isn't given a sink
+	std::unique_ptr<StringOutputSink> m_bufferSink;
+	OutputSink& m_sink;
+	// Value of the current objects list item, and objects list, which are written after schema table
+	BufferOutputSink m_valueBuffer;
+	BufferOutputSink m_objectsBuffer;
+	std::string m_schemaBuffer;
+	// Sink the current value is written to
+	OutputSink* m_out = nullptr;
+	std::unordered_map<detail::ObjectKey, uint64_t, detail::ObjectKeyHash> m_objectIds;
+	std::deque<PendingObject> m_pendingObjects;
+	uint64_t m_nextObjectId = 1U;
+	bool m_rootReferenced = false;
+	detail::binary::SchemaTableWriter m_schemaTable;
+	bool m_writeSchemaTable = true;
+	bool m_writeObjectsIndex = false;
+	std::unique_ptr<rs::detail::SerializationContext> m_context;
+};
+
+} // namespace rs
@@ -0,0 +1,633 @@
+#include "writers/CborWriter.hpp"
+#include "rttr/Manager.hpp"
+#include "rttr/Property.hpp"
+#include "rs/ByteOrder.hpp"
+#include "rs/CborFormat.hpp"
+#include "rs/SerializationKeywords.hpp"
+#include "rs/log/Log.hpp"
+
+#include <cstring>
+
+namespace rs
+{
+
+namespace cbor = detail::cbor;
+
+namespace
+{
+
+// Typed array tag of host byte order items, see RFC 8746 section 2.1, or zero for numeric kinds with no tag
+uint64_t GetTypedArrayTag(const rttr::NumericKind kind)
+{
+	constexpr uint64_t k_hostByteOrderFlag = (k_hostByteOrder == ByteOrder::LittleEndian) ? cbor::k_typedArrayLittleEndianFlag : 0U;
+	constexpr uint64_t k_signedTag = cbor::k_typedArrayFirstTag | cbor::k_typedArraySignedFlag;
+	constexpr uint64_t k_floatTag = cbor::k_typedArrayFirstTag | cbor::k_typedArrayFloatFlag;
+
+	switch (kind)
+	{
+	case rttr::NumericKind::UInt8:
+		return cbor::k_typedArrayFirstTag;
+	case rttr::NumericKind::Int8:
+		return k_signedTag;
+	case rttr::NumericKind::UInt16:
+		return cbor::k_typedArrayFirstTag | k_hostByteOrderFlag | 1U;
+	case rttr::NumericKind::Int16:
+		return k_signedTag | k_hostByteOrderFlag | 1U;
+	case rttr::NumericKind::UInt32:
+		return cbor::k_typedArrayFirstTag | k_hostByteOrderFlag | 2U;
+	case rttr::NumericKind::Int32:
+		return k_signedTag | k_hostByteOrderFlag | 2U;
+	case rttr::NumericKind::UInt64:
+		return cbor::k_typedArrayFirstTag | k_hostByteOrderFlag | 3U;
+	case rttr::NumericKind::Int64:
+		return k_signedTag | k_hostByteOrderFlag | 3U;
+	case rttr::NumericKind::Float:
+		return k_floatTag | k_hostByteOrderFlag | 1U;
+	case rttr::NumericKind::Double:
+		return k_floatTag | k_hostByteOrderFlag | 2U;
+	default:
+		return 0U;
+	}
+}
+
+}
+
+CborWriter::CborWriter()
+	: m_bufferSink(std::make_unique<StringOutputSink>(m_buffer))
+	, m_sink(*m_bufferSink)
+{}
+
+CborWriter::CborWriter(OutputSink& sink)
+	: m_sink(sink)
+{}
+
+const std::string& CborWriter::GetBuffer() const
+{
+	return m_buffer;
+}
+
+bool CborWriter::Write(const rttr::Type& type, const void* value)
+{
+	if (!type.IsValid() || !value || !m_sink.IsOk())
+		return false;
+
+	if (m_bufferSink)
+	{
+		m_bufferSink->Clear();
+	}
+
+	m_objectIds.clear();
+	m_pendingObjects.clear();
+	m_rootReferenced = false;
+	m_context = std::make_unique<rs::detail::SerializationContext>();
+
+	// Root object gets the first id, so pointers back to it are resolved to the master object
+	m_objectIds.emplace(detail::ObjectKey{ value, type }, 1U);
+	m_nextObjectId = 2U;
+
+	bool isComplete = true;
+
+	if (!type.CanReferenceObjects())
+	{
+		// Root value is the whole document
+		m_out = &m_sink;
+		WriteValue(type, value, ObjectExtras());
+
+		// Types changed after the root type was checked may reference objects, which can't be written then
+		isComplete = m_pendingObjects.empty() && !m_rootReferenced;
+	}
+	else
+	{
+		// Root value is written as the first item of objects list, item header is dropped if nothing is referenced
+		m_objectsBuffer.Clear();
+		m_out = &m_objectsBuffer;
+
+		WriteMapHeader(2U);
+		WriteString(K_CONTEXT_OBJ_ID);
+		WriteUnsigned(1U);
+		WriteString(K_CONTEXT_OBJ_VAL);
+
+		const std::size_t rootOffset = m_objectsBuffer.GetSize();
+		WriteValue(type, value, ObjectExtras());
+
+		if (m_pendingObjects.empty() && !m_rootReferenced)
+		{
+			m_sink.Append(m_objectsBuffer.GetData() + rootOffset, m_objectsBuffer.GetSize() - rootOffset);
+		}
+		else
+		{
+			std::size_t objectsCount = 1U;
+
+			// Objects may reference other objects, which are queued while writing, so every object is written exactly once
+			while (!m_pendingObjects.empty())
+			{
+				const PendingObject object = m_pendingObjects.front();
+				m_pendingObjects.pop_front();
+
+				WriteMapHeader(2U);
+				WriteString(K_CONTEXT_OBJ_ID);
+				WriteUnsigned(object.id);
+				WriteString(K_CONTEXT_OBJ_VAL);
+
+				ObjectExtras extras;
+				if (object.writeTypeId)
+				{
+					extras.typeId = object.type.GetName();
+				}
+
+				WriteValue(object.type, object.value, extras);
+
+				++objectsCount;
+			}
+
+			m_out = &m_sink;
+			WriteMapHeader(2U);
+			WriteString(K_MASTER_OBJ_ID);
+			WriteUnsigned(1U);
+			WriteString(K_CONTEXT_OBJECTS);
+			WriteArrayHeader(objectsCount);
+			m_sink.Append(m_objectsBuffer.GetData(), m_objectsBuffer.GetSize());
+		}
+	}
+
+	m_out = nullptr;
+	m_context.reset();
+
+	if (!isComplete)
+	{
+		RS_LOG_ERROR("Type '%s' was changed after its first write, referenced objects are not written!", type.GetName());
+		return false;
+	}
+
+	return m_sink.Flush();
+}
+
+void CborWriter::WriteValue(const rttr::Type& type, const void* value, const ObjectExtras& extras)
+{
+	switch (type.GetPredefinedType())
+	{
+	case rs::PredefinedType::StdString:
+	{
+		const std::string& str = *static_cast<const std::string*>(value);
+		WriteString(str.data(), str.size());
+	}
+	return;
+	case rs::PredefinedType::CString:
+	{
+		const char* str = static_cast<const char*>(*reinterpret_cast<const void* const*>(value));
+		if (nullptr == str)
+		{
+			WriteNull();
+		}
+		else
+		{
+			WriteString(str);
+		}
+	}
+	return;
+	default:
+		break;
+	}
+
+	switch (type.GetSerializationMethod())
+	{
+	case rs::SerializationMethod::Proxy:
+	{
+		rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+		if (nullptr != proxyTypeData && proxyTypeData->writeConverter)
+		{
+			void* targetObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+			proxyTypeData->writeConverter->Convert(targetObject, value);
+
+			WriteValue(proxyTypeData->proxyType, targetObject, extras);
+
+			m_context->DestroyTempVariable(targetObject);
+		}
+		else
+		{
+			WriteNull();
+		}
+	}
+	break;
+	case rs::SerializationMethod::Adapter:
+	{
+		SerializationAdapter* adapter = type.GetSerializationAdapter();
+		if (nullptr != adapter)
+		{
+			WriteAdapter(adapter, value);
+		}
+		else
+		{
+			WriteNull();
+		}
+	}
+	break;
+	default:
+	{
+		switch (type.GetTypeClass())
+		{
+		case rttr::TypeClass::Object:
+		{
+			WriteObject(type, value, extras);
+		}
+		break;
+		case rttr::TypeClass::Pointer:
+		{
+			WritePointer(type, value);
+		}
+		break;
+		case rttr::TypeClass::Enum:
+		{
+			WriteValue(type.GetEnumUnderlyingType(), value, extras);
+		}
+		break;
+		case rttr::TypeClass::Real:
+		{
+			if (type.GetTypeIndex() == typeid(float))
+			{
+				WriteFloat(*static_cast<const float*>(value));
+			}
+			else
+			{
+				WriteDouble(*static_cast<const double*>(value));
+			}
+		}
+		break;
+		case rttr::TypeClass::Integral:
+		{
+			WriteIntegral(type, value);
+		}
+		break;
+		case rttr::TypeClass::Array:
+		{
+			WriteArray(type, value);
+		}
+		break;
+		default:
+		{
+			WriteNull();
+		}
+		break;
+		}
+	}
+	break;
+	}
+}
+
+void CborWriter::WriteObject(const rttr::Type& type, const void* value, const ObjectExtras& extras)
+{
+	const std::size_t propertiesCount = type.GetPropertiesCount();
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	const bool isCollection = type.IsCollection();
+	const bool hasPayload = extras.payload.type.IsValid() && extras.payload.value;
+
+	const std::size_t reservedMembersCount = (extras.typeId ? 1U : 0U) + (extras.baseId ? 1U : 0U) + (hasPayload ? 1U : 0U) + (baseClassesInfo.second > 0U ? 1U : 0U);
+
+	// Collection without any other members is written as plain array, like in json
+	if (isCollection && propertiesCount == 0U && reservedMembersCount == 0U)
+	{
+		WriteCollectionItems(type, value);
+		return;
+	}
+
+	WriteMapHeader(reservedMembersCount + propertiesCount + (isCollection ? 1U : 0U));
+
+	if (extras.typeId)
+	{
+		WriteString(K_TYPE_ID);
+		WriteString(extras.typeId);
+	}
+
+	if (extras.baseId)
+	{
+		WriteString(K_BASE_ID);
+		WriteString(extras.baseId);
+	}
+
+	if (hasPayload)
+	{
+		WriteString(K_ADAPTER);
+		WriteValue(extras.payload.type, extras.payload.value, ObjectExtras());
+	}
+
+	if (baseClassesInfo.second > 0U)
+	{
+		WriteString(K_BASES);
+		WriteArrayHeader(baseClassesInfo.second);
+
+		for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+		{
+			const rttr::Type& baseClass = baseClassesInfo.first[i];
+
+			ObjectExtras baseExtras;
+			baseExtras.baseId = baseClass.GetName();
+			WriteObject(baseClass, value, baseExtras);
+		}
+	}
+
+	for (std::size_t i = 0U; i < propertiesCount; ++i)
+	{
+		rttr::Property* const prop = type.GetProperty(i);
+
+		void* propValue = nullptr;
+		bool needRelease = false;
+		prop->GetValue(value, propValue, needRelease);
+
+		WriteString(prop->GetName());
+		WriteValue(prop->GetType(), propValue, ObjectExtras());
+
+		// Release temp object if required
+		if (needRelease)
+		{
+			prop->GetType().Destroy(propValue);
+		}
+	}
+
+	if (isCollection)
+	{
+		WriteString(K_COLLECTION_ITEMS);
+		WriteCollectionItems(type, value);
+	}
+}
+
+void CborWriter::WriteCollectionItems(const rttr::Type& type, const void* value)
+{
+	const rttr::Type itemType = type.GetCollectionItemType();
+
+	if (itemType.IsPlainNumeric() && type.IsContiguousCollection())
+	{
+		std::size_t itemsCount = 0U;
+		const void* items = type.GetCollectionItemsData(value, itemsCount);
+
+		WriteNumericItems(itemType.GetNumericKind(), items, itemsCount);
+		return;
+	}
+
+	std::unique_ptr<rttr::CollectionIteratorBase> it = type.CreateCollectionIterator(const_cast<void*>(value));
+	if (!it)
+	{
+		RS_LOG_ERROR("Collection '%s' can't be iterated, items are not written!", type.GetName());
+		WriteArrayHeader(0U);
+		return;
+	}
+
+	// Count is written before items, so iterate twice, it's cheaper than buffering items
+	std::size_t itemsCount = 0U;
+	for (; *it; ++(*it))
+	{
+		++itemsCount;
+	}
+
+	WriteArrayHeader(itemsCount);
+
+	for (it = type.CreateCollectionIterator(const_cast<void*>(value)); *it; ++(*it))
+	{
+		WriteValue(itemType, *(*it), ObjectExtras());
+	}
+}
+
+void CborWriter::WritePointer(const rttr::Type& type, const void* value)
+{
+	const void* pointedValue = *static_cast<const void* const*>(value);
+	if (nullptr == pointedValue)
+	{
+		WriteNull();
+		return;
+	}
+
+	// Objects are identified by address of most derived object, so base and derived pointers to it share the id
+	const rttr::Type pointedType = type.GetPointedType();
+	const void* objectValue = nullptr;
+	const rttr::Type objectType = pointedType.GetDynamicType(pointedValue, objectValue);
+
+	WriteUnsigned(GetObjectId(objectType, objectValue, objectType != pointedType));
+}
+
+void CborWriter::WriteAdapter(SerializationAdapter* adapter, const void* value)
+{
+	SerializationAdapter::AdapterWriteOutput adapterOutput = adapter->Write(value);
+
+	// Payload is attached to value object, as json writer does
+	ObjectExtras extras;
+	extras.payload = adapterOutput.payload;
+
+	if (adapterOutput.value.type.IsValid() && adapterOutput.value.value)
+	{
+		WriteValue(adapterOutput.value.type, adapterOutput.value.value, extras);
+	}
+	else if (extras.payload.type.IsValid() && extras.payload.value)
+	{
+		WriteMapHeader(1U);
+		WriteString(K_ADAPTER);
+		WriteValue(extras.payload.type, extras.payload.value, ObjectExtras());
+	}
+	else
+	{
+		WriteMapHeader(0U);
+	}
+
+	adapter->WriteFinalize(value);
+}
+
+void CborWriter::WriteArray(const rttr::Type& type, const void* value)
+{
+	const rttr::Type arrayType = type.GetArrayType();
+	const uint8_t* arrayBytePtr = static_cast<const uint8_t*>(value);
+	const std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	// Arrays of numbers are written at once, skipping per item dispatch
+	if (arrayType.IsPlainNumeric())
+	{
+		WriteNumericItems(arrayType.GetNumericKind(), value, totalSize);
+		return;
+	}
+
+	WriteArrayHeader(totalSize);
+
+	for (std::size_t i = 0U; i < totalSize; i++)
+	{
+		WriteValue(arrayType, arrayBytePtr + itemSize * i, ObjectExtras());
+	}
+}
+
+void CborWriter::WriteIntegral(const rttr::Type& type, const void* value)
+{
+	if (type.GetTypeIndex() == typeid(bool))
+	{
+		WriteBool(*static_cast<const bool*>(value));
+	}
+	else if (type.IsSignedIntegral())
+	{
+		WriteSigned(type.CastToSignedInteger(value));
+	}
+	else
+	{
+		WriteUnsigned(type.CastToUnsignedInteger(value));
+	}
+}
+
+void CborWriter::WriteNumericItems(const rttr::NumericKind kind, const void* items, const std::size_t count)
+{
+	const uint64_t tag = GetTypedArrayTag(kind);
+	if (tag == 0U)
+	{
+		// Booleans have no typed array tag
+		const bool* boolItems = static_cast<const bool*>(items);
+
+		WriteArrayHeader(count);
+		for (std::size_t i = 0U; i < count; ++i)
+		{
+			WriteBool(boolItems[i]);
+		}
+
+		return;
+	}
+
+	std::size_t itemSize = 0U;
+	rttr::VisitNumericKind(kind, [&itemSize](auto numericTag)
+	{
+		itemSize = sizeof(typename decltype(numericTag)::type);
+		return true;
+	});
+
+	// Items are kept in host byte order, tag tells the reader which one it is
+	WriteHead(cbor::k_majorTag, tag);
+	WriteHead(cbor::k_majorBytes, count * itemSize);
+	m_out->Append(static_cast<const char*>(items), count * itemSize);
+}
+
+uint64_t CborWriter::GetObjectId(const rttr::Type& type, const void* value, const bool writeTypeId)
+{
+	// Objects are keyed by address and type, so each pair gets exactly one id
+	auto insertResult = m_objectIds.emplace(detail::ObjectKey{ value, type }, m_nextObjectId);
+	if (!insertResult.second)
+	{
+		if (insertResult.first->second == 1U)
+		{
+			m_rootReferenced = true;
+		}
+
+		return insertResult.first->second;
+	}
+
+	const uint64_t objectId = m_nextObjectId++;
+	m_pendingObjects.push_back(PendingObject{ objectId, type, value, writeTypeId });
+
+	return objectId;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Encoding, every value is written with the smallest representation
+
+void CborWriter::WriteNull()
+{
+	m_out->Append(static_cast<char>(cbor::k_null));
+}
+
+void CborWriter::WriteBool(const bool value)
+{
+	m_out->Append(static_cast<char>(value ? cbor::k_true : cbor::k_false));
+}
+
+void CborWriter::WriteUnsigned(const uint64_t value)
+{
+	WriteHead(cbor::k_majorUnsigned, value);
+}
+
+void CborWriter::WriteSigned(const int64_t value)
+{
+	if (value >= 0)
+	{
+		WriteHead(cbor::k_majorUnsigned, static_cast<uint64_t>(value));
+	}
+	else
+	{
+		// Negative integers are stored as -1 - value, which is bitwise complement in two's complement form
+		WriteHead(cbor::k_majorNegative, ~static_cast<uint64_t>(value));
+	}
+}
+
+void CborWriter::WriteFloat(const float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	WriteBigEndian(cbor::k_float32, bits, 4U);
+}
+
+void CborWriter::WriteDouble(const double value)
+{
+	uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	WriteBigEndian(cbor::k_float64, bits, 8U);
+}
+
+void CborWriter::WriteString(const char* str, const std::size_t length)
+{
+	WriteHead(cbor::k_majorText, length);
+	m_out->Append(str, length);
+}
+
+void CborWriter::WriteString(const char* str)
+{
+	WriteString(str, std::strlen(str));
+}
+
+void CborWriter::WriteArrayHeader(const std::size_t count)
+{
+	WriteHead(cbor::k_majorArray, count);
+}
+
+void CborWriter::WriteMapHeader(const std::size_t count)
+{
+	WriteHead(cbor::k_majorMap, count);
+}
+
+void CborWriter::WriteHead(const uint8_t majorType, const uint64_t argument)
+{
+	const uint8_t majorBits = static_cast<uint8_t>(majorType << 5);
+
+	if (argument <= cbor::k_infoMaxImmediate)
+	{
+		m_out->Append(static_cast<char>(majorBits | argument));
+	}
+	else if (argument <= UINT8_MAX)
+	{
+		WriteBigEndian(majorBits | cbor::k_info8, argument, 1U);
+	}
+	else if (argument <= UINT16_MAX)
+	{
+		WriteBigEndian(majorBits | cbor::k_info16, argument, 2U);
+	}
+	else if (argument <= UINT32_MAX)
+	{
+		WriteBigEndian(majorBits | cbor::k_info32, argument, 4U);
+	}
+	else
+	{
+		WriteBigEndian(majorBits | cbor::k_info64, argument, 8U);
+	}
+}
+
+void CborWriter::WriteBigEndian(const uint8_t initialByte, const uint64_t value, const std::size_t size)
+{
+	if (!m_out->Reserve(size + 1U))
+		return;
+
+	char* bytes = m_out->GetCursor();
+	bytes[0] = static_cast<char>(initialByte);
+
+	for (std::size_t i = 0U; i < size; ++i)
+	{
+		bytes[size - i] = static_cast<char>(value >> (8U * i));
+	}
+
+	m_out->Advance(size + 1U);
+}
+
+} // namespace rs
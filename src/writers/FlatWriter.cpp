@@ -0,0 +1,357 @@
+#include "writers/FlatWriter.hpp"
+#include "rttr/Manager.hpp"
+#include "rttr/Property.hpp"
+#include "rs/ByteOrder.hpp"
+#include "rs/FlatFormat.hpp"
+#include "rs/log/Log.hpp"
+
+#include <cstring>
+
+namespace rs
+{
+
+namespace flat = detail::flat;
+
+const std::string& FlatWriter::GetBuffer() const
+{
+	return m_buffer;
+}
+
+bool FlatWriter::Write(const rttr::Type& type, const void* value)
+{
+	if (!type.IsValid() || !value)
+		return false;
+
+	m_buffer.assign(flat::k_headerSize, '\0');
+	std::memcpy(&m_buffer[0], flat::k_magic, sizeof(flat::k_magic));
+	m_buffer[3] = static_cast<char>(flat::k_version);
+	m_buffer[4] = static_cast<char>((k_hostByteOrder == ByteOrder::BigEndian) ? flat::k_flagBigEndian : 0U);
+
+	m_slotsStack.clear();
+	m_objectRecords.clear();
+	m_typeNames.clear();
+	m_pendingObjects.clear();
+	m_context = std::make_unique<rs::detail::SerializationContext>();
+
+	// Root object record is allocated only if root is referenced, it's patched once root value is written
+	m_objectRecords.emplace(value, std::make_pair(std::size_t(0U), type));
+	m_rootRecordOffset = 0U;
+
+	const uint64_t rootSlot = WriteValue(type, value);
+	PatchSlot(flat::k_rootSlotPosition, rootSlot);
+	PatchSlot(flat::k_rootTypeNamePosition, GetTypeNameOffset(type));
+
+	// Objects may reference other objects, which are queued while writing, so every object is written exactly once
+	while (!m_pendingObjects.empty())
+	{
+		const PendingObject object = m_pendingObjects.front();
+		m_pendingObjects.pop_front();
+
+		const uint64_t objectSlot = WriteValue(object.type, object.value);
+		PatchSlot(object.recordOffset + flat::k_slotSize, objectSlot);
+	}
+
+	if (m_rootRecordOffset != 0U)
+	{
+		PatchSlot(m_rootRecordOffset + flat::k_slotSize, rootSlot);
+	}
+
+	m_context.reset();
+
+	return true;
+}
+
+uint64_t FlatWriter::WriteValue(const rttr::Type& type, const void* value)
+{
+	const rttr::Type encodedType = flat::GetEncodedType(type);
+	if (encodedType != type)
+	{
+		rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+		if (nullptr == proxyTypeData || !proxyTypeData->writeConverter)
+			return 0U;
+
+		void* proxyValue = m_context->CreateTempVariable(encodedType);
+		proxyTypeData->writeConverter->Convert(proxyValue, value);
+
+		const uint64_t slot = WriteValue(encodedType, proxyValue);
+
+		m_context->DestroyTempVariable(proxyValue);
+		return slot;
+	}
+
+	switch (flat::GetValueEncoding(type))
+	{
+	case flat::ValueEncoding::Scalar:
+	{
+		uint64_t slot = 0U;
+		if (type.GetSize() <= sizeof(slot))
+		{
+			std::memcpy(&slot, value, type.GetSize());
+		}
+
+		return slot;
+	}
+	case flat::ValueEncoding::String:
+	{
+		if (type.GetPredefinedType() == rs::PredefinedType::StdString)
+		{
+			const std::string& str = *static_cast<const std::string*>(value);
+			return WriteString(str.data(), str.size());
+		}
+
+		const char* str = static_cast<const char*>(*reinterpret_cast<const void* const*>(value));
+		return (nullptr != str) ? WriteString(str, std::strlen(str)) : 0U;
+	}
+	case flat::ValueEncoding::Raw:
+		return WriteRaw(type, value);
+	case flat::ValueEncoding::Table:
+		return WriteTable(type, value);
+	case flat::ValueEncoding::Items:
+		return (type.GetTypeClass() == rttr::TypeClass::Array) ? WriteArrayItems(type, value) : WriteCollectionItems(type, value);
+	case flat::ValueEncoding::Pointer:
+		return WritePointer(type, value);
+	default:
+		RS_LOG_WARNING("Type '%s' isn't supported by flat format, value is skipped!", type.GetName());
+		return 0U;
+	}
+}
+
+uint64_t FlatWriter::WriteString(const char* str, const std::size_t length)
+{
+	const std::size_t offset = BeginBlock(flat::k_blockAlignment);
+
+	AppendSlot(length);
+	m_buffer.append(str, length);
+	m_buffer.push_back('\0');
+
+	return offset;
+}
+
+uint64_t FlatWriter::WriteRaw(const rttr::Type& type, const void* value)
+{
+	const std::size_t offset = BeginBlock(flat::GetRawAlignment(type));
+	m_buffer.append(static_cast<const char*>(value), type.GetSize());
+
+	return offset;
+}
+
+uint64_t FlatWriter::WriteTable(const rttr::Type& type, const void* value)
+{
+	const std::size_t slotsBegin = m_slotsStack.size();
+
+	// Base parts are written as objects of base type, at the same address, as other writers do
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+	{
+		const uint64_t baseSlot = WriteValue(baseClassesInfo.first[i], value);
+		m_slotsStack.push_back(baseSlot);
+	}
+
+	const std::size_t propertiesCount = type.GetPropertiesCount();
+	for (std::size_t i = 0U; i < propertiesCount; ++i)
+	{
+		rttr::Property* const prop = type.GetProperty(i);
+
+		void* propValue = nullptr;
+		bool needRelease = false;
+		prop->GetValue(value, propValue, needRelease);
+
+		const uint64_t propertySlot = WriteValue(prop->GetType(), propValue);
+		m_slotsStack.push_back(propertySlot);
+
+		// Release temp object if required
+		if (needRelease)
+		{
+			prop->GetType().Destroy(propValue);
+		}
+	}
+
+	if (type.IsCollection())
+	{
+		const uint64_t itemsSlot = WriteCollectionItems(type, value);
+		m_slotsStack.push_back(itemsSlot);
+	}
+
+	return WriteSlotsBlock(slotsBegin);
+}
+
+uint64_t FlatWriter::WriteCollectionItems(const rttr::Type& type, const void* value)
+{
+	const rttr::Type itemType = type.GetCollectionItemType();
+	const bool isRawItems = itemType.IsBlittable();
+
+	if (isRawItems && type.IsContiguousCollection())
+	{
+		std::size_t itemsCount = 0U;
+		const void* items = type.GetCollectionItemsData(value, itemsCount);
+
+		return WriteRawItems(itemType, items, itemsCount);
+	}
+
+	std::unique_ptr<rttr::CollectionIteratorBase> it = type.CreateCollectionIterator(const_cast<void*>(value));
+	if (!it)
+	{
+		RS_LOG_ERROR("Collection '%s' can't be iterated, items are not written!", type.GetName());
+		return WriteSlotsBlock(m_slotsStack.size());
+	}
+
+	if (isRawItems)
+	{
+		// Raw items are appended one by one, they have no blocks of their own, so items stay contiguous
+		const std::size_t offset = BeginBlock(flat::k_blockAlignment);
+		AppendSlot(0U);
+		BeginBlock(flat::GetRawAlignment(itemType));
+
+		const std::size_t itemSize = itemType.GetSize();
+		uint64_t itemsCount = 0U;
+
+		for (; *it; ++(*it))
+		{
+			m_buffer.append(static_cast<const char*>(*(*it)), itemSize);
+			++itemsCount;
+		}
+
+		PatchSlot(offset, itemsCount);
+		return offset;
+	}
+
+	const std::size_t slotsBegin = m_slotsStack.size();
+
+	for (; *it; ++(*it))
+	{
+		const uint64_t itemSlot = WriteValue(itemType, *(*it));
+		m_slotsStack.push_back(itemSlot);
+	}
+
+	return WriteSlotsBlock(slotsBegin);
+}
+
+uint64_t FlatWriter::WriteArrayItems(const rttr::Type& type, const void* value)
+{
+	const rttr::Type arrayType = type.GetArrayType();
+	const uint8_t* arrayBytePtr = static_cast<const uint8_t*>(value);
+	const std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	if (arrayType.IsBlittable())
+		return WriteRawItems(arrayType, value, totalSize);
+
+	const std::size_t slotsBegin = m_slotsStack.size();
+
+	for (std::size_t i = 0U; i < totalSize; i++)
+	{
+		const uint64_t itemSlot = WriteValue(arrayType, arrayBytePtr + itemSize * i);
+		m_slotsStack.push_back(itemSlot);
+	}
+
+	return WriteSlotsBlock(slotsBegin);
+}
+
+uint64_t FlatWriter::WritePointer(const rttr::Type& type, const void* value)
+{
+	const void* pointedValue = *static_cast<const void* const*>(value);
+	if (nullptr == pointedValue)
+		return 0U;
+
+	// Objects are identified by address of most derived object, so base and derived pointers to it share the record
+	const rttr::Type pointedType = type.GetPointedType();
+	const void* objectValue = nullptr;
+	const rttr::Type objectType = pointedType.GetDynamicType(pointedValue, objectValue);
+
+	auto it = m_objectRecords.find(objectValue);
+	if (it != m_objectRecords.end() && it->second.second == objectType && it->second.first != 0U)
+		return it->second.first;
+
+	// Record is shared by pointers of different static types, so type name of polymorphic object is always written
+	const std::size_t recordOffset = BeginBlock(flat::k_blockAlignment);
+	m_buffer.append(flat::k_pointerRecordSize, '\0');
+
+	if (objectType.IsPolymorphic())
+	{
+		PatchSlot(recordOffset, GetTypeNameOffset(objectType));
+	}
+
+	if (it != m_objectRecords.end() && it->second.second == objectType)
+	{
+		// Root value is written already, or is being written, so its record is patched at the end
+		it->second.first = recordOffset;
+		m_rootRecordOffset = recordOffset;
+		return recordOffset;
+	}
+
+	m_pendingObjects.push_back(PendingObject{ recordOffset, objectType, objectValue });
+
+	// Object of other type at the same address (like first member of the object) is written separately
+	if (it == m_objectRecords.end())
+	{
+		m_objectRecords.emplace(objectValue, std::make_pair(recordOffset, objectType));
+	}
+
+	return recordOffset;
+}
+
+uint64_t FlatWriter::WriteRawItems(const rttr::Type& itemType, const void* items, const std::size_t count)
+{
+	const std::size_t offset = BeginBlock(flat::k_blockAlignment);
+	AppendSlot(count);
+	BeginBlock(flat::GetRawAlignment(itemType));
+
+	if (count > 0U)
+	{
+		m_buffer.append(static_cast<const char*>(items), count * itemType.GetSize());
+	}
+
+	return offset;
+}
+
+uint64_t FlatWriter::WriteSlotsBlock(const std::size_t slotsBegin)
+{
+	const std::size_t slotsCount = m_slotsStack.size() - slotsBegin;
+	const std::size_t offset = BeginBlock(flat::k_blockAlignment);
+
+	AppendSlot(slotsCount);
+	if (slotsCount > 0U)
+	{
+		m_buffer.append(reinterpret_cast<const char*>(m_slotsStack.data() + slotsBegin), slotsCount * flat::k_slotSize);
+	}
+
+	m_slotsStack.resize(slotsBegin);
+	return offset;
+}
+
+std::size_t FlatWriter::BeginBlock(const std::size_t alignment)
+{
+	m_buffer.resize(flat::AlignOffset(m_buffer.size(), alignment), '\0');
+	return m_buffer.size();
+}
+
+void FlatWriter::AppendSlot(const uint64_t slot)
+{
+	m_buffer.append(reinterpret_cast<const char*>(&slot), sizeof(slot));
+}
+
+void FlatWriter::PatchSlot(const std::size_t position, const uint64_t slot)
+{
+	std::memcpy(&m_buffer[position], &slot, sizeof(slot));
+}
+
+uint64_t FlatWriter::GetTypeNameOffset(const rttr::Type& type)
+{
+	const char* typeName = type.GetName();
+
+	auto it = m_typeNames.find(typeName);
+	if (it != m_typeNames.end())
+		return it->second;
+
+	const uint64_t offset = WriteString(typeName, std::strlen(typeName));
+	m_typeNames.emplace(typeName, offset);
+
+	return offset;
+}
+
+} // namespace rs
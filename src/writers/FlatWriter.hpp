@@ -0,0 +1,72 @@
+#pragma once
+#include "writers/IWriter.hpp"
+#include "SerializationContext.hpp"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace rs
+{
+
+/*
+* @brief Flat zero-copy format writer
+*
+* Lays out values so they can be accessed in place with ValueView and View, without reading them back into objects
+* (see FlatFormat.hpp). Values are written bottom up, so every block is written once and never moved,
+* pointed objects are written after the root value, and their pointer records are patched afterwards.
+*/
+class FlatWriter
+	: public IWriter
+{
+public:
+	FlatWriter() = default;
+	~FlatWriter() = default;
+
+	bool RAVEN_SERIALIZE_API Write(const rttr::Type& type, const void* value) override;
+	// Serialized data of the last write
+	RAVEN_SERIALIZE_API const std::string& GetBuffer() const;
+
+private:
+	struct PendingObject
+	{
+		std::size_t recordOffset;
+		rttr::Type type;
+		const void* value;
+	};
+
+	// Writes value blocks, and returns the slot referencing the value
+	uint64_t WriteValue(const rttr::Type& type, const void* value);
+	uint64_t WriteString(const char* str, const std::size_t length);
+	uint64_t WriteRaw(const rttr::Type& type, const void* value);
+	uint64_t WriteTable(const rttr::Type& type, const void* value);
+	uint64_t WriteCollectionItems(const rttr::Type& type, const void* value);
+	uint64_t WriteArrayItems(const rttr::Type& type, const void* value);
+	uint64_t WritePointer(const rttr::Type& type, const void* value);
+	// Writes items block of count raw items, items are copied at once
+	uint64_t WriteRawItems(const rttr::Type& itemType, const void* items, const std::size_t count);
+	// Writes items block of slots, pushed to slots stack starting at slotsBegin, and pops them
+	uint64_t WriteSlotsBlock(const std::size_t slotsBegin);
+
+	// Aligns buffer end and returns offset of the new block
+	std::size_t BeginBlock(const std::size_t alignment);
+	void AppendSlot(const uint64_t slot);
+	void PatchSlot(const std::size_t position, const uint64_t slot);
+	// Type names are written once, and shared by all pointer records
+	uint64_t GetTypeNameOffset(const rttr::Type& type);
+
+private:
+	std::string m_buffer;
+	// Slots of tables and items being written, nested values push their slots above the ones of enclosing values
+	std::vector<uint64_t> m_slotsStack;
+	// Pointer record offset by object address and type
+	std::unordered_map<const void*, std::pair<std::size_t, rttr::Type>> m_objectRecords;
+	std::unordered_map<const char*, uint64_t> m_typeNames;
+	std::deque<PendingObject> m_pendingObjects;
+	std::size_t m_rootRecordOffset = 0U;
+	std::unique_ptr<rs::detail::SerializationContext> m_context;
+};
+
+} // namespace rs
@@ -0,0 +1,262 @@
+#include "writers/JsonEmitter.hpp"
+#include "rs/NumberFormat.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+
+const char k_hexDigits[] = "0123456789abcdef";
+
+}
+
+namespace rs
+{
+
+namespace detail
+{
+
+JsonEmitter::JsonEmitter(OutputSink& sink, const bool prettyPrint)
+	: m_sink(sink)
+	, m_prettyPrint(prettyPrint)
+{}
+
+void JsonEmitter::Reset()
+{
+	m_scopeHasItems.clear();
+	m_padding = 0;
+}
+
+template <typename T>
+void JsonEmitter::WriteNumber(const T value)
+{
+	if constexpr (std::is_same_v<T, bool>)
+	{
+		WriteBool(value);
+	}
+	else if constexpr (std::is_same_v<T, float>)
+	{
+		WriteFloat(value);
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		WriteDouble(static_cast<double>(value));
+	}
+	else if constexpr (std::is_signed_v<T>)
+	{
+		WriteSigned(static_cast<int64_t>(value));
+	}
+	else
+	{
+		WriteUnsigned(static_cast<uint64_t>(value));
+	}
+}
+
+void JsonEmitter::WriteNumericItems(const rttr::NumericKind kind, const void* items, const std::size_t count)
+{
+	// Numbers are kept on a single line even when pretty printing
+	m_sink.Append('[');
+
+	rttr::VisitNumericKind(kind, [this, items, count](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+
+		const T* typedItems = static_cast<const T*>(items);
+		for (std::size_t i = 0U; i < count; ++i)
+		{
+			if (i > 0U)
+			{
+				m_sink.Append(',');
+				if (m_prettyPrint)
+				{
+					m_sink.Append(' ');
+				}
+			}
+
+			WriteNumber(typedItems[i]);
+		}
+
+		return true;
+	});
+
+	m_sink.Append(']');
+}
+
+void JsonEmitter::BeginScope(const char openToken)
+{
+	m_sink.Append(openToken);
+	m_scopeHasItems.push_back(false);
+	++m_padding;
+}
+
+void JsonEmitter::EndScope(const char closeToken)
+{
+	--m_padding;
+
+	const bool hasItems = m_scopeHasItems.back();
+	m_scopeHasItems.pop_back();
+
+	if (m_prettyPrint && hasItems)
+	{
+		m_sink.Append('\n');
+		WritePadding();
+	}
+
+	m_sink.Append(closeToken);
+}
+
+void JsonEmitter::BeginItem()
+{
+	if (m_scopeHasItems.back())
+	{
+		m_sink.Append(',');
+	}
+
+	m_scopeHasItems.back() = true;
+
+	if (m_prettyPrint)
+	{
+		m_sink.Append('\n');
+		WritePadding();
+	}
+}
+
+void JsonEmitter::WriteKey(const char* name)
+{
+	BeginItem();
+	WriteString(name);
+	if (m_prettyPrint)
+	{
+		m_sink.Append(" : ", 3U);
+	}
+	else
+	{
+		m_sink.Append(':');
+	}
+}
+
+void JsonEmitter::WritePadding()
+{
+	const std::size_t paddingSize = static_cast<std::size_t>(m_padding);
+	if (m_sink.Reserve(paddingSize))
+	{
+		std::memset(m_sink.GetCursor(), '\t', paddingSize);
+		m_sink.Advance(paddingSize);
+	}
+}
+
+void JsonEmitter::WriteNull()
+{
+	m_sink.Append("null", 4U);
+}
+
+void JsonEmitter::WriteBool(const bool value)
+{
+	if (value)
+	{
+		m_sink.Append("true", 4U);
+	}
+	else
+	{
+		m_sink.Append("false", 5U);
+	}
+}
+
+void JsonEmitter::WriteUnsigned(const uint64_t value)
+{
+	char digits[k_maxNumberLength];
+	m_sink.Append(digits, static_cast<std::size_t>(FormatNumber(digits, value) - digits));
+}
+
+void JsonEmitter::WriteSigned(const int64_t value)
+{
+	char digits[k_maxNumberLength];
+	m_sink.Append(digits, static_cast<std::size_t>(FormatNumber(digits, value) - digits));
+}
+
+void JsonEmitter::WriteFloat(const float value)
+{
+	if (!std::isfinite(value))
+	{
+		// Json has no representation for nan and infinity
+		WriteNull();
+		return;
+	}
+
+	// Float is formatted with float precision, not as widened double
+	char digits[k_maxNumberLength];
+	m_sink.Append(digits, static_cast<std::size_t>(FormatNumber(digits, value) - digits));
+}
+
+void JsonEmitter::WriteDouble(const double value)
+{
+	if (!std::isfinite(value))
+	{
+		WriteNull();
+		return;
+	}
+
+	char digits[k_maxNumberLength];
+	m_sink.Append(digits, static_cast<std::size_t>(FormatNumber(digits, value) - digits));
+}
+
+void JsonEmitter::WriteString(const char* str, const std::size_t length)
+{
+	m_sink.Append('"');
+
+	// Runs of characters without escaping are appended at once
+	std::size_t runBegin = 0U;
+	for (std::size_t i = 0U; i < length; ++i)
+	{
+		const unsigned char c = static_cast<unsigned char>(str[i]);
+		if (c >= 0x20U && c != '"' && c != '\\')
+			continue;
+
+		m_sink.Append(str + runBegin, i - runBegin);
+		runBegin = i + 1U;
+
+		switch (c)
+		{
+		case '"':
+			m_sink.Append("\\\"", 2U);
+			break;
+		case '\\':
+			m_sink.Append("\\\\", 2U);
+			break;
+		case '\b':
+			m_sink.Append("\\b", 2U);
+			break;
+		case '\f':
+			m_sink.Append("\\f", 2U);
+			break;
+		case '\n':
+			m_sink.Append("\\n", 2U);
+			break;
+		case '\r':
+			m_sink.Append("\\r", 2U);
+			break;
+		case '\t':
+			m_sink.Append("\\t", 2U);
+			break;
+		default:
+		{
+			const char escaped[] = { '\\', 'u', '0', '0', k_hexDigits[c >> 4U], k_hexDigits[c & 0x0FU] };
+			m_sink.Append(escaped, sizeof(escaped));
+		}
+		break;
+		}
+	}
+
+	m_sink.Append(str + runBegin, length - runBegin);
+	m_sink.Append('"');
+}
+
+void JsonEmitter::WriteString(const char* str)
+{
+	WriteString(str, std::strlen(str));
+}
+
+} // namespace detail
+
+} // namespace rs
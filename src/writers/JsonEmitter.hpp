@@ -0,0 +1,60 @@
+#pragma once
+#include "writers/OutputSink.hpp"
+#include "rttr/details/ScalarParams.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace rs
+{
+
+namespace detail
+{
+
+/*
+* @brief Emits json tokens to the output sink, keeping track of separators and padding
+*
+* Numbers are written in the shortest form that is parsed back to the same value, floats with float precision.
+*/
+class JsonEmitter
+{
+public:
+	JsonEmitter(OutputSink& sink, const bool prettyPrint);
+
+	void Reset();
+
+	// Scopes are objects and arrays, items of the innermost scope are separated with commas
+	void BeginScope(const char openToken);
+	void EndScope(const char closeToken);
+	void BeginItem();
+	void WriteKey(const char* name);
+
+	void WriteNull();
+	void WriteBool(const bool value);
+	void WriteUnsigned(const uint64_t value);
+	void WriteSigned(const int64_t value);
+	void WriteFloat(const float value);
+	void WriteDouble(const double value);
+	void WriteString(const char* str, const std::size_t length);
+	void WriteString(const char* str);
+	// Writes contiguous numeric items as array in a single loop, without per item dispatch
+	void WriteNumericItems(const rttr::NumericKind kind, const void* items, const std::size_t count);
+
+private:
+	void WritePadding();
+
+	template <typename T>
+	void WriteNumber(const T value);
+
+private:
+	OutputSink& m_sink;
+	const bool m_prettyPrint;
+	int m_padding = 0;
+	// Whether innermost scopes already have items, one entry per nesting level
+	std::vector<bool> m_scopeHasItems;
+};
+
+} // namespace detail
+
+} // namespace rs
@@ -1,25 +1,110 @@
 #include "writers/JsonWriter.hpp"
 #include "rttr/Manager.hpp"
 #include "rs/SerializationKeywords.hpp"
+#include "rs/NumberFormat.hpp"
+#include "writers/JsonEmitter.hpp"
+#include "rs/log/Log.hpp"
 
 namespace
 {
 
-using PredefinedTypeWriter = std::function<Json::Value(const rttr::Type&, const void*)>;
-const std::unordered_map<std::type_index, PredefinedTypeWriter> gPredefinedWriters = {
+using PredefinedTypeWriter = Json::Value(*)(const rttr::Type&, const void*);
+
+Json::Value WriteStdString(const rttr::Type& type, const void* value)
+{
+	const std::string& str = *static_cast<const std::string*>(value);
+	return Json::Value(str.c_str());
+}
+
+Json::Value WriteCString(const rttr::Type& type, const void* value)
+{
+	const char* str = static_cast<const char*>(*reinterpret_cast<const void* const*>(value));
+	return Json::Value(str);
+}
+
+// Writers are indexed by predefined type id stored in the type codec slot
+const PredefinedTypeWriter gPredefinedWriters[static_cast<std::size_t>(rs::PredefinedType::Count)] = {
+	nullptr,
+	&WriteStdString,
+	&WriteCString,
+};
+
+// Writes contiguous numeric items in a single loop, without per item dispatch
+bool WriteNumericItems(Json::Value& jsonArray, const rttr::NumericKind kind, const void* items, const std::size_t count)
+{
+	return rttr::VisitNumericKind(kind, [&jsonArray, items, count](auto tag)
+	{
+		using T = typename decltype(tag)::type;
+
+		const T* typedItems = static_cast<const T*>(items);
+		for (std::size_t i = 0U; i < count; ++i)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				jsonArray.append(Json::Value(rs::detail::WidenFloatShortest(typedItems[i])));
+			}
+			else
+			{
+				jsonArray.append(Json::Value(typedItems[i]));
+			}
+		}
+
+		return true;
+	});
+}
+
+void EmitJsonValue(rs::detail::JsonEmitter& emitter, const Json::Value& jsonValue)
+{
+	switch (jsonValue.type())
+	{
+	case Json::intValue:
+		emitter.WriteSigned(jsonValue.asInt64());
+		break;
+	case Json::uintValue:
+		emitter.WriteUnsigned(jsonValue.asUInt64());
+		break;
+	case Json::realValue:
+		emitter.WriteDouble(jsonValue.asDouble());
+		break;
+	case Json::stringValue:
+	{
+		const char* begin = nullptr;
+		const char* end = nullptr;
+		jsonValue.getString(&begin, &end);
+		emitter.WriteString(begin, static_cast<std::size_t>(end - begin));
+	}
+	break;
+	case Json::booleanValue:
+		emitter.WriteBool(jsonValue.asBool());
+		break;
+	case Json::arrayValue:
 	{
-		typeid(std::string), [](const rttr::Type& type, const void* value) -> Json::Value {
-			const std::string& str = *static_cast<const std::string*>(value);
-			return Json::Value(str.c_str());
+		emitter.BeginScope('[');
+		for (const Json::Value& item : jsonValue)
+		{
+			emitter.BeginItem();
+			EmitJsonValue(emitter, item);
 		}
-	},
+		emitter.EndScope(']');
+	}
+	break;
+	case Json::objectValue:
 	{
-		typeid(const char*), [](const rttr::Type& type, const void* value) -> Json::Value {
-			const char* str = static_cast<const char*>(*reinterpret_cast<const void* const*>(value));
-			return Json::Value(str);
+		emitter.BeginScope('{');
+		for (auto it = jsonValue.begin(); it != jsonValue.end(); ++it)
+		{
+			emitter.WriteKey(it.name().c_str());
+			EmitJsonValue(emitter, *it);
 		}
-	},
-};
+		emitter.EndScope('}');
+	}
+	break;
+	case Json::nullValue:
+	default:
+		emitter.WriteNull();
+		break;
+	}
+}
 
 }
 
@@ -31,25 +116,98 @@ const Json::Value& JsonWriter::GetJsonValue() const
 	return m_jsonRoot;
 }
 
+bool JsonWriter::WriteText(OutputSink& sink, const bool prettyPrint) const
+{
+	detail::JsonEmitter emitter(sink, prettyPrint);
+	EmitJsonValue(emitter, m_jsonRoot);
+
+	return sink.Flush();
+}
+
 bool JsonWriter::Write(const rttr::Type& type, const void* value)
 {
-	if (type.IsValid() && value)
+	if (!type.IsValid() || !value)
+		return false;
+
+	m_objectIds.clear();
+	m_pendingObjects.clear();
+	m_rootReferenced = false;
+	m_context = std::make_unique<rs::detail::SerializationContext>();
+
+	// Root object gets the first id, so pointers back to it are resolved to the master object
+	m_objectIds.emplace(detail::ObjectKey{ value, type }, 1U);
+	m_nextObjectId = 2U;
+
+	bool isOk = true;
+	Json::Value rootJson = WriteInternal(type, value);
+
+	if (m_pendingObjects.empty() && !m_rootReferenced)
 	{
-		m_jsonRoot = WriteInternal(type, value);
-		return true;
+		// Nothing is referenced, so root value is the whole document
+		m_jsonRoot = std::move(rootJson);
 	}
+	else
+	{
+		Json::Value contextObjects(Json::ValueType::arrayValue);
+
+		Json::Value masterObject(Json::ValueType::objectValue);
+		masterObject[K_CONTEXT_OBJ_ID] = Json::Value(Json::UInt64(1U));
+		masterObject[K_CONTEXT_OBJ_VAL] = std::move(rootJson);
+		contextObjects.append(std::move(masterObject));
+
+		// Objects may reference other objects, which are queued while writing, so every object is written exactly once
+		while (!m_pendingObjects.empty())
+		{
+			const PendingObject object = m_pendingObjects.front();
+			m_pendingObjects.pop_front();
 
-	return false;
+			Json::Value objectJson = WriteInternal(object.type, object.value);
+			if (object.writeTypeId)
+			{
+				// Collection written as plain array is moved under items key, so type id has a place next to it
+				if (objectJson.isArray() && object.type.GetSerializationMethod() == rs::SerializationMethod::Default && object.type.IsCollection())
+				{
+					Json::Value collectionJson(Json::ValueType::objectValue);
+					collectionJson[K_COLLECTION_ITEMS] = std::move(objectJson);
+					objectJson = std::move(collectionJson);
+				}
+
+				if (objectJson.isObject())
+				{
+					objectJson[K_TYPE_ID] = object.type.GetName();
+				}
+				else
+				{
+					// Object would be read back as pointer static type
+					RS_LOG_ERROR("Type id of object of type '%s' can't be written, as it isn't written as json object!", object.type.GetName());
+					isOk = false;
+				}
+			}
+
+			Json::Value contextObject(Json::ValueType::objectValue);
+			contextObject[K_CONTEXT_OBJ_ID] = Json::Value(Json::UInt64(object.id));
+			contextObject[K_CONTEXT_OBJ_VAL] = std::move(objectJson);
+			contextObjects.append(std::move(contextObject));
+		}
+
+		m_jsonRoot = Json::Value(Json::ValueType::objectValue);
+		m_jsonRoot[K_MASTER_OBJ_ID] = Json::Value(Json::UInt64(1U));
+		m_jsonRoot[K_CONTEXT_OBJECTS] = std::move(contextObjects);
+	}
+
+	m_context.reset();
+
+	return isOk;
 }
 
 
 Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 {
-	// Find in predefined types list
-	auto predefinedTypeIt = gPredefinedWriters.find(type.GetTypeIndex());
-	if (predefinedTypeIt != gPredefinedWriters.end())
+	// Predefined types are resolved with codec slot of the type
+	const rs::PredefinedType predefinedType = type.GetPredefinedType();
+	if (predefinedType != rs::PredefinedType::None)
 	{
-		return predefinedTypeIt->second(type, value);
+		return gPredefinedWriters[static_cast<std::size_t>(predefinedType)](type, value);
 	}
 	else
 	{
@@ -59,7 +217,7 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 		{
 		case rs::SerializationMethod::Proxy:
 		{
-			rttr::TypeProxyData* proxyTypeData = rttr::Manager::GetRTTRManager().GetProxyType(type);
+			rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
 			if (nullptr != proxyTypeData)
 			{
 				return WriteProxy(proxyTypeData, value);
@@ -68,7 +226,7 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 		break;
 		case rs::SerializationMethod::Adapter:
 		{
-			SerializationAdapter* adapter = rttr::Manager::GetRTTRManager().GetSerializationAdapter(type);
+			SerializationAdapter* adapter = type.GetSerializationAdapter();
 			if (nullptr != adapter)
 			{
 				// Perform adapter logic, that generates optional payload and actual value
@@ -104,14 +262,15 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 				const std::size_t propertiesCount = type.GetPropertiesCount();
 
 				Json::Value jsonObject = Json::Value(Json::ValueType::objectValue);
-				if (propertiesCount == 0U && type.IsCollection())
+				// Collection without any other members is written as plain array
+				if (propertiesCount == 0U && type.IsCollection() && type.GetBaseClasses().second == 0U)
 				{
 					jsonObject = Json::Value(Json::ValueType::arrayValue);
 				}
 
-				// [TODO] Add support for base classes parts
+				WriteObjectBases(type, value, jsonObject);
 
-				// Read object properties if any
+				// Write object properties if any
 				if (propertiesCount > 0U)
 				{
 					WriteObjectProperties(type, value, jsonObject);
@@ -124,11 +283,20 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 					Json::Value* collectionItemsValue = jsonObject.isArray() ? &jsonObject : &dedicatedArrayValue;
 
 					const rttr::Type itemType = type.GetCollectionItemType();
-					for (auto it = type.CreateCollectionIterator(const_cast<void*>(value)); *it; ++(*it))
+					if (itemType.IsPlainNumeric() && type.IsContiguousCollection())
 					{
-						void* itemValue = *(*it);
-						Json::Value itemJson = WriteInternal(itemType, itemValue);
-						collectionItemsValue->append(std::move(itemJson));
+						std::size_t itemsCount = 0U;
+						const void* items = type.GetCollectionItemsData(value, itemsCount);
+						WriteNumericItems(*collectionItemsValue, itemType.GetNumericKind(), items, itemsCount);
+					}
+					else
+					{
+						for (auto it = type.CreateCollectionIterator(const_cast<void*>(value)); *it; ++(*it))
+						{
+							void* itemValue = *(*it);
+							Json::Value itemJson = WriteInternal(itemType, itemValue);
+							collectionItemsValue->append(std::move(itemJson));
+						}
 					}
 
 					if (collectionItemsValue != &jsonObject)
@@ -142,7 +310,7 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 			break;
 			case rttr::TypeClass::Pointer:
 			{
-				return Json::Value(Json::ValueType::nullValue);
+				return WritePointer(type, value);
 			}
 			break;
 			case rttr::TypeClass::Enum:
@@ -155,7 +323,8 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 			{
 				if (type.GetTypeIndex() == typeid(float))
 				{
-					return Json::Value(*static_cast<const float*>(value));
+					// Stored as the double of float shortest form, so it isn't printed with digits of float widening
+					return Json::Value(detail::WidenFloatShortest(*static_cast<const float*>(value)));
 				}
 				else
 				{
@@ -218,6 +387,29 @@ Json::Value JsonWriter::WriteInternal(const rttr::Type& type, const void* value)
 	return Json::Value(Json::ValueType::nullValue);
 }
 
+void JsonWriter::WriteObjectBases(const rttr::Type& type, const void* value, Json::Value& jsonObject)
+{
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	if (baseClassesInfo.second == 0U)
+		return;
+
+	// Bases are written as separate objects, each tagged by base type name, so reader matches them regardless of order
+	Json::Value basesJson(Json::ValueType::arrayValue);
+	for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+	{
+		const rttr::Type& baseClass = baseClassesInfo.first[i];
+
+		Json::Value baseJson = WriteInternal(baseClass, value);
+		if (baseJson.isObject())
+		{
+			baseJson[K_BASE_ID] = baseClass.GetName();
+			basesJson.append(std::move(baseJson));
+		}
+	}
+
+	jsonObject[K_BASES] = std::move(basesJson);
+}
+
 void JsonWriter::WriteObjectProperties(const rttr::Type& type, const void* value, Json::Value& jsonObject)
 {
 	const std::size_t propertiesCount = type.GetPropertiesCount();
@@ -257,6 +449,42 @@ Json::Value JsonWriter::WriteProxy(rttr::TypeProxyData* proxyTypeData, const voi
 	return Json::Value(Json::ValueType::nullValue);
 }
 
+Json::Value JsonWriter::WritePointer(const rttr::Type& type, const void* value)
+{
+	const void* pointedValue = *static_cast<const void* const*>(value);
+	if (nullptr == pointedValue)
+	{
+		return Json::Value(Json::ValueType::nullValue);
+	}
+
+	// Objects are identified by address of most derived object, so base and derived pointers to it share the id
+	const rttr::Type pointedType = type.GetPointedType();
+	const void* objectValue = nullptr;
+	const rttr::Type objectType = pointedType.GetDynamicType(pointedValue, objectValue);
+
+	return Json::Value(Json::UInt64(GetObjectId(objectType, objectValue, objectType != pointedType)));
+}
+
+uint64_t JsonWriter::GetObjectId(const rttr::Type& type, const void* value, const bool writeTypeId)
+{
+	// Objects are keyed by address and type, so each pair gets exactly one id
+	auto insertResult = m_objectIds.emplace(detail::ObjectKey{ value, type }, m_nextObjectId);
+	if (!insertResult.second)
+	{
+		if (insertResult.first->second == 1U)
+		{
+			m_rootReferenced = true;
+		}
+
+		return insertResult.first->second;
+	}
+
+	const uint64_t objectId = m_nextObjectId++;
+	m_pendingObjects.push_back(PendingObject{ objectId, type, value, writeTypeId });
+
+	return objectId;
+}
+
 Json::Value JsonWriter::WriteArray(const rttr::Type& type, const void* value)
 {
 	Json::Value outJsonValue(Json::ValueType::arrayValue);
@@ -271,6 +499,13 @@ Json::Value JsonWriter::WriteArray(const rttr::Type& type, const void* value)
 		totalSize *= type.GetArrayExtent(i);
 	}
 
+	// Arrays of numbers are written at once, skipping per item dispatch
+	if (arrayType.IsPlainNumeric())
+	{
+		WriteNumericItems(outJsonValue, arrayType.GetNumericKind(), value, totalSize);
+		return outJsonValue;
+	}
+
 	for (std::size_t i = 0U; i < totalSize; i++)
 	{
 		const uint8_t* itemPtr = arrayBytePtr + itemSize * i;
@@ -1,14 +1,23 @@
 #pragma once
 #include "writers/IWriter.hpp"
+#include "writers/OutputSink.hpp"
 #include "SerializationContext.hpp"
 
 #include <ostream>
 #include <memory>
+#include <deque>
+#include <unordered_map>
 #include <json/json.h>
 
 namespace rs
 {
 
+/*
+* @brief Json writer implementation, builds Json::Value document
+*
+* Objects referenced by pointers are written once each into objects list, pointers are written as ids of the objects,
+* so shared and cyclic references are preserved, and document size depends on the number of unique objects.
+*/
 class JsonWriter
 	: public IWriter
 {
@@ -18,16 +27,39 @@ public:
 
 	bool RAVEN_SERIALIZE_API Write(const rttr::Type& type, const void* value) override;
 	RAVEN_SERIALIZE_API const Json::Value& GetJsonValue() const;
+	// Writes json text of the last write to the sink, numbers are written in the shortest form restoring the same value
+	bool RAVEN_SERIALIZE_API WriteText(OutputSink& sink, const bool prettyPrint = false) const;
 
 private:
+	struct PendingObject
+	{
+		uint64_t id;
+		rttr::Type type;
+		const void* value;
+		// Type id is written only if it differs from the pointer static type
+		bool writeTypeId;
+	};
+
 	Json::Value WriteInternal(const rttr::Type& type, const void* value);
+	void WriteObjectBases(const rttr::Type& type, const void* value, Json::Value& jsonObject);
 	void WriteObjectProperties(const rttr::Type& type, const void* value, Json::Value& jsonObject);
 	Json::Value WriteProxy(rttr::TypeProxyData* proxyTypeData, const void* value);
 	Json::Value WriteArray(const rttr::Type& type, const void* value);
+	Json::Value WritePointer(const rttr::Type& type, const void* value);
+
+	// Returns id of the object, registering it in objects list on first reference
+	uint64_t GetObjectId(const rttr::Type& type, const void* value, const bool writeTypeId);
 
 protected:
 	Json::Value m_jsonRoot;
 	std::unique_ptr<rs::detail::SerializationContext> m_context;
+
+private:
+	// Objects are identified by address and type, as object and its first member share the address
+	std::unordered_map<detail::ObjectKey, uint64_t, detail::ObjectKeyHash> m_objectIds;
+	std::deque<PendingObject> m_pendingObjects;
+	uint64_t m_nextObjectId = 1U;
+	bool m_rootReferenced = false;
 };
 
 } // namespace rs
@@ -0,0 +1,98 @@
+#pragma once
+#include "writers/IWriter.hpp"
+#include "writers/OutputSink.hpp"
+#include "rs/SerializationAdapter.hpp"
+#include "SerializationContext.hpp"
+
+#include <string>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace rs
+{
+
+/*
+* @brief MessagePack writer implementation
+*
+* Documents have the same structure as json ones, objects are maps keyed by property names, and reserved keys are used
+* for bases, collection items, adapters payload and objects list, so data can be consumed without C++ types registration.
+* Objects referenced by pointers are written once each into objects list, shared and cyclic references are preserved.
+* Values of types which can't reference objects are encoded straight into the output sink, objects list is collected
+* in a buffer first, as its items count is written in front of it.
+*/
+class MsgPackWriter
+	: public IWriter
+{
+public:
+	RAVEN_SERIALIZE_API MsgPackWriter();
+	// Sink is not owned and must outlive the writer
+	explicit RAVEN_SERIALIZE_API MsgPackWriter(OutputSink& sink);
+	~MsgPackWriter() = default;
+
+	bool RAVEN_SERIALIZE_API Write(const rttr::Type& type, const void* value) override;
+	// Serialized data of the last write, empty if writer writes to the sink given on construction
+	RAVEN_SERIALIZE_API const std::string& GetBuffer() const;
+
+private:
+	// Reserved members written in front of object properties
+	struct ObjectExtras
+	{
+		const char* typeId = nullptr;
+		const char* baseId = nullptr;
+		SerializationAdapter::DataChunk payload;
+	};
+
+	struct PendingObject
+	{
+		uint64_t id;
+		rttr::Type type;
+		const void* value;
+		// Type id is written only if it differs from the pointer static type
+		bool writeTypeId;
+	};
+
+	void WriteValue(const rttr::Type& type, const void* value, const ObjectExtras& extras);
+	void WriteObject(const rttr::Type& type, const void* value, const ObjectExtras& extras);
+	void WriteCollectionItems(const rttr::Type& type, const void* value);
+	void WritePointer(const rttr::Type& type, const void* value);
+	void WriteAdapter(SerializationAdapter* adapter, const void* value);
+	void WriteArray(const rttr::Type& type, const void* value);
+	void WriteIntegral(const rttr::Type& type, const void* value);
+	// Writes contiguous numeric items in a single loop, without per item dispatch
+	void WriteNumericItems(const rttr::NumericKind kind, const void* items, const std::size_t count);
+
+	// Returns id of the object, registering it in objects list on first reference
+	uint64_t GetObjectId(const rttr::Type& type, const void* value, const bool writeTypeId);
+
+	void WriteNil();
+	void WriteBool(const bool value);
+	void WriteUnsigned(const uint64_t value);
+	void WriteSigned(const int64_t value);
+	void WriteFloat(const float value);
+	void WriteDouble(const double value);
+	void WriteString(const char* str, const std::size_t length);
+	void WriteString(const char* str);
+	void WriteArrayHeader(const std::size_t count);
+	void WriteMapHeader(const std::size_t count);
+	void WriteBigEndian(const uint8_t marker, const uint64_t value, const std::size_t size);
+
+	template <typename T>
+	void WriteNumber(const T value);
+
+private:
+	std::string m_buffer;
+	// Sink writing to the buffer, if writer isn't given a sink
+	std::unique_ptr<StringOutputSink> m_bufferSink;
+	OutputSink& m_sink;
+	BufferOutputSink m_objectsBuffer;
+	// Sink the current value is written to
+	OutputSink* m_out = nullptr;
+	std::unordered_map<detail::ObjectKey, uint64_t, detail::ObjectKeyHash> m_objectIds;
+	std::deque<PendingObject> m_pendingObjects;
+	uint64_t m_nextObjectId = 1U;
+	bool m_rootReferenced = false;
+	std::unique_ptr<rs::detail::SerializationContext> m_context;
+};
+
+} // namespace rs
@@ -0,0 +1,308 @@
+#include "writers/OutputSink.hpp"
+#include "rs/log/Log.hpp"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace rs
+{
+
+BufferOutputSink::BufferOutputSink(const std::size_t initialCapacity)
+	: m_storage(new char[std::max<std::size_t>(initialCapacity, 1U)])
+{
+	m_begin = m_storage.get();
+	m_cursor = m_begin;
+	m_end = m_begin + std::max<std::size_t>(initialCapacity, 1U);
+}
+
+void BufferOutputSink::Clear()
+{
+	m_cursor = m_begin;
+	m_isOk = true;
+}
+
+bool BufferOutputSink::Grow(const std::size_t size)
+{
+	const std::size_t usedSize = static_cast<std::size_t>(m_cursor - m_begin);
+	const std::size_t capacity = static_cast<std::size_t>(m_end - m_begin);
+	const std::size_t newCapacity = std::max(capacity * 2U, usedSize + size);
+
+	// Data is moved to a bigger buffer, doubling keeps appends amortized constant
+	std::unique_ptr<char[]> newStorage(new char[newCapacity]);
+	std::memcpy(newStorage.get(), m_begin, usedSize);
+	m_storage = std::move(newStorage);
+
+	m_begin = m_storage.get();
+	m_cursor = m_begin + usedSize;
+	m_end = m_begin + newCapacity;
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+StringOutputSink::StringOutputSink(std::string& target)
+	: m_target(target)
+	, m_baseSize(target.size())
+{}
+
+bool StringOutputSink::Flush()
+{
+	// Spare space is dropped, the string keeps its capacity, so next appends are cheap anyway
+	const std::size_t usedSize = static_cast<std::size_t>(m_cursor - m_begin);
+	m_target.resize(m_baseSize + usedSize);
+
+	m_begin = m_target.data() + m_baseSize;
+	m_cursor = m_begin + usedSize;
+	m_end = m_cursor;
+
+	return m_isOk;
+}
+
+void StringOutputSink::Clear()
+{
+	m_target.clear();
+	m_baseSize = 0U;
+
+	m_begin = nullptr;
+	m_cursor = nullptr;
+	m_end = nullptr;
+	m_isOk = true;
+}
+
+bool StringOutputSink::Grow(const std::size_t size)
+{
+	const std::size_t usedSize = static_cast<std::size_t>(m_cursor - m_begin);
+	const std::size_t capacity = static_cast<std::size_t>(m_end - m_begin);
+	const std::size_t newCapacity = std::max(std::max<std::size_t>(capacity * 2U, 64U), usedSize + size);
+
+	m_target.resize(m_baseSize + newCapacity);
+
+	m_begin = m_target.data() + m_baseSize;
+	m_cursor = m_begin + usedSize;
+	m_end = m_begin + newCapacity;
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+StreamOutputSink::StreamOutputSink(std::ostream& stream, const std::size_t bufferSize)
+	: m_stream(stream)
+	, m_storage(new char[std::max<std::size_t>(bufferSize, 1U)])
+{
+	m_begin = m_storage.get();
+	m_cursor = m_begin;
+	m_end = m_begin + std::max<std::size_t>(bufferSize, 1U);
+}
+
+StreamOutputSink::~StreamOutputSink()
+{
+	Flush();
+}
+
+bool StreamOutputSink::Flush()
+{
+	const std::size_t usedSize = static_cast<std::size_t>(m_cursor - m_begin);
+	if (usedSize > 0U)
+	{
+		m_stream.write(m_begin, static_cast<std::streamsize>(usedSize));
+		m_committedSize += usedSize;
+		m_cursor = m_begin;
+	}
+
+	m_isOk = m_isOk && m_stream.good();
+	return m_isOk;
+}
+
+bool StreamOutputSink::Grow(const std::size_t size)
+{
+	if (!Flush())
+		return false;
+
+	// Buffer is enlarged only for values bigger than the whole buffer
+	if (static_cast<std::size_t>(m_end - m_begin) < size)
+	{
+		m_storage.reset(new char[size]);
+		m_begin = m_storage.get();
+		m_cursor = m_begin;
+		m_end = m_begin + size;
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+FileDescriptorOutputSink::FileDescriptorOutputSink(const int fileDescriptor, const std::size_t chunkSize, const std::size_t chunksCount)
+	: m_fileDescriptor(fileDescriptor)
+	, m_chunks(std::max<std::size_t>(chunksCount, 1U))
+{
+	for (Chunk& chunk : m_chunks)
+	{
+		chunk.capacity = std::max<std::size_t>(chunkSize, 1U);
+		chunk.data.reset(new char[chunk.capacity]);
+	}
+
+	UseChunk(0U, 0U);
+}
+
+FileDescriptorOutputSink::~FileDescriptorOutputSink()
+{
+	Flush();
+}
+
+bool FileDescriptorOutputSink::Flush()
+{
+	if (!WriteChunks())
+	{
+		m_isOk = false;
+	}
+
+	UseChunk(0U, 0U);
+	return m_isOk;
+}
+
+bool FileDescriptorOutputSink::Grow(const std::size_t size)
+{
+	m_chunks[m_currentChunkIdx].size = static_cast<std::size_t>(m_cursor - m_begin);
+
+	if (m_currentChunkIdx + 1U < m_chunks.size())
+	{
+		// Filled chunks wait until all chunks are used
+		m_committedSize += m_chunks[m_currentChunkIdx].size;
+		UseChunk(m_currentChunkIdx + 1U, size);
+		return true;
+	}
+
+	if (!WriteChunks())
+	{
+		m_isOk = false;
+		UseChunk(0U, size);
+		return false;
+	}
+
+	UseChunk(0U, size);
+	return true;
+}
+
+void FileDescriptorOutputSink::UseChunk(const std::size_t chunkIdx, const std::size_t size)
+{
+	Chunk& chunk = m_chunks[chunkIdx];
+	if (chunk.capacity < size)
+	{
+		chunk.capacity = size;
+		chunk.data.reset(new char[size]);
+	}
+
+	chunk.size = 0U;
+	m_currentChunkIdx = chunkIdx;
+
+	m_begin = chunk.data.get();
+	m_cursor = m_begin;
+	m_end = m_begin + chunk.capacity;
+}
+
+bool FileDescriptorOutputSink::WriteChunks()
+{
+	Chunk& currentChunk = m_chunks[m_currentChunkIdx];
+	currentChunk.size = static_cast<std::size_t>(m_cursor - m_begin);
+	m_committedSize += currentChunk.size;
+
+	// Data in the current chunk is counted as committed now, so cursor is reset to chunk begin
+	m_cursor = m_begin;
+
+	if (!m_isOk)
+		return false;
+
+#ifdef _WIN32
+	for (std::size_t i = 0U; i <= m_currentChunkIdx; ++i)
+	{
+		const char* data = m_chunks[i].data.get();
+		std::size_t remainingSize = m_chunks[i].size;
+
+		while (remainingSize > 0U)
+		{
+			const int written = _write(m_fileDescriptor, data, static_cast<unsigned int>(std::min<std::size_t>(remainingSize, 1U << 30U)));
+			if (written <= 0)
+			{
+				RS_LOG_ERROR("Failed to write to file descriptor %d!", m_fileDescriptor);
+				return false;
+			}
+
+			data += written;
+			remainingSize -= static_cast<std::size_t>(written);
+		}
+	}
+#else
+	std::vector<iovec> ioVectors;
+	ioVectors.reserve(m_currentChunkIdx + 1U);
+
+	for (std::size_t i = 0U; i <= m_currentChunkIdx; ++i)
+	{
+		if (m_chunks[i].size > 0U)
+		{
+			ioVectors.push_back({ m_chunks[i].data.get(), m_chunks[i].size });
+		}
+	}
+
+	// Partial writes continue from the first not fully written chunk
+	std::size_t firstVectorIdx = 0U;
+	while (firstVectorIdx < ioVectors.size())
+	{
+		const ssize_t written = writev(m_fileDescriptor, ioVectors.data() + firstVectorIdx, static_cast<int>(ioVectors.size() - firstVectorIdx));
+		if (written < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			RS_LOG_ERROR("Failed to write to file descriptor %d!", m_fileDescriptor);
+			return false;
+		}
+
+		std::size_t remainingWritten = static_cast<std::size_t>(written);
+		while (firstVectorIdx < ioVectors.size() && remainingWritten >= ioVectors[firstVectorIdx].iov_len)
+		{
+			remainingWritten -= ioVectors[firstVectorIdx].iov_len;
+			++firstVectorIdx;
+		}
+
+		if (remainingWritten > 0U)
+		{
+			ioVectors[firstVectorIdx].iov_base = static_cast<char*>(ioVectors[firstVectorIdx].iov_base) + remainingWritten;
+			ioVectors[firstVectorIdx].iov_len -= remainingWritten;
+		}
+	}
+#endif
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+FixedBufferOutputSink::FixedBufferOutputSink(char* buffer, const std::size_t size)
+{
+	m_begin = buffer;
+	m_cursor = buffer;
+	m_end = buffer + size;
+}
+
+bool FixedBufferOutputSink::Grow(const std::size_t size)
+{
+	if (m_isOk)
+	{
+		RS_LOG_ERROR("Output buffer of %zu bytes is too small, %zu more bytes don't fit!", static_cast<std::size_t>(m_end - m_begin), size);
+	}
+
+	m_isOk = false;
+	return false;
+}
+
+} // namespace rs
@@ -0,0 +1,238 @@
+#pragma once
+#include "raven_serialize_export.h"
+
+#include <ostream>
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace rs
+{
+
+/*
+* @brief Destination of serialized data, writers emit bytes straight into its buffer
+*
+* Appending is inlined and only checks remaining buffer space, implementations are called when buffer is full,
+* to pass buffered data on or to provide more space. Data may stay buffered until Flush.
+*/
+class OutputSink
+{
+public:
+	virtual ~OutputSink() = default;
+
+	// Makes at least size bytes available at cursor, returns false if sink can't take more data
+	bool Reserve(const std::size_t size)
+	{
+		return (static_cast<std::size_t>(m_end - m_cursor) >= size) || Grow(size);
+	}
+
+	void Append(const char* data, const std::size_t size)
+	{
+		if (size > 0U && Reserve(size))
+		{
+			std::memcpy(m_cursor, data, size);
+			m_cursor += size;
+		}
+	}
+
+	void Append(const char value)
+	{
+		if (m_cursor != m_end || Grow(1U))
+		{
+			*m_cursor++ = value;
+		}
+	}
+
+	// Reserved space at cursor may be written directly, Advance commits written bytes
+	char* GetCursor()
+	{
+		return m_cursor;
+	}
+
+	void Advance(const std::size_t size)
+	{
+		m_cursor += size;
+	}
+
+	// Passes buffered data to the destination
+	virtual bool Flush()
+	{
+		return m_isOk;
+	}
+
+	// False once any data was lost
+	bool IsOk() const
+	{
+		return m_isOk;
+	}
+
+	// Bytes appended since sink creation or last clear
+	uint64_t GetWrittenSize() const
+	{
+		return m_committedSize + static_cast<uint64_t>(m_cursor - m_begin);
+	}
+
+protected:
+	// Provides at least size bytes at cursor, by passing buffered data on or by growing buffer
+	virtual bool Grow(const std::size_t size) = 0;
+
+protected:
+	char* m_begin = nullptr;
+	char* m_cursor = nullptr;
+	char* m_end = nullptr;
+	// Bytes appended before current buffer
+	uint64_t m_committedSize = 0U;
+	bool m_isOk = true;
+};
+
+/*
+* @brief Sink collecting data in a contiguous buffer, which grows as needed
+*/
+class BufferOutputSink
+	: public OutputSink
+{
+public:
+	explicit RAVEN_SERIALIZE_API BufferOutputSink(const std::size_t initialCapacity = 4096U);
+
+	BufferOutputSink(const BufferOutputSink&) = delete;
+	BufferOutputSink& operator=(const BufferOutputSink&) = delete;
+
+	const char* GetData() const
+	{
+		return m_begin;
+	}
+
+	std::size_t GetSize() const
+	{
+		return static_cast<std::size_t>(m_cursor - m_begin);
+	}
+
+	// Drops written data, buffer memory is kept for reuse
+	void RAVEN_SERIALIZE_API Clear();
+
+protected:
+	bool RAVEN_SERIALIZE_API Grow(const std::size_t size) final;
+
+private:
+	std::unique_ptr<char[]> m_storage;
+};
+
+/*
+* @brief Sink collecting data in a string, string is used as the buffer, so data isn't copied when sink is done
+*
+* String is enlarged ahead of appended data, and trimmed to appended data on flush.
+*/
+class StringOutputSink
+	: public OutputSink
+{
+public:
+	// String is not owned and must outlive the sink, data is appended to its current content
+	explicit RAVEN_SERIALIZE_API StringOutputSink(std::string& target);
+
+	StringOutputSink(const StringOutputSink&) = delete;
+	StringOutputSink& operator=(const StringOutputSink&) = delete;
+
+	bool RAVEN_SERIALIZE_API Flush() final;
+	// Empties the string, its memory is kept for reuse
+	void RAVEN_SERIALIZE_API Clear();
+
+protected:
+	bool RAVEN_SERIALIZE_API Grow(const std::size_t size) final;
+
+private:
+	std::string& m_target;
+	// String size before the first appended byte
+	std::size_t m_baseSize = 0U;
+};
+
+/*
+* @brief Sink passing data to the stream in large chunks, so stream is called once per chunk instead of once per token
+*/
+class StreamOutputSink
+	: public OutputSink
+{
+public:
+	explicit RAVEN_SERIALIZE_API StreamOutputSink(std::ostream& stream, const std::size_t bufferSize = 64U * 1024U);
+	RAVEN_SERIALIZE_API ~StreamOutputSink();
+
+	StreamOutputSink(const StreamOutputSink&) = delete;
+	StreamOutputSink& operator=(const StreamOutputSink&) = delete;
+
+	bool RAVEN_SERIALIZE_API Flush() final;
+
+protected:
+	bool RAVEN_SERIALIZE_API Grow(const std::size_t size) final;
+
+private:
+	std::ostream& m_stream;
+	std::unique_ptr<char[]> m_storage;
+};
+
+/*
+* @brief Sink writing to the file descriptor, for example file or socket, descriptor is not owned
+*
+* Data is collected in several chunks, and all filled chunks are written with a single writev call.
+*/
+class FileDescriptorOutputSink
+	: public OutputSink
+{
+public:
+	explicit RAVEN_SERIALIZE_API FileDescriptorOutputSink(const int fileDescriptor, const std::size_t chunkSize = 64U * 1024U, const std::size_t chunksCount = 8U);
+	RAVEN_SERIALIZE_API ~FileDescriptorOutputSink();
+
+	FileDescriptorOutputSink(const FileDescriptorOutputSink&) = delete;
+	FileDescriptorOutputSink& operator=(const FileDescriptorOutputSink&) = delete;
+
+	bool RAVEN_SERIALIZE_API Flush() final;
+
+protected:
+	bool RAVEN_SERIALIZE_API Grow(const std::size_t size) final;
+
+private:
+	struct Chunk
+	{
+		std::unique_ptr<char[]> data;
+		std::size_t capacity = 0U;
+		std::size_t size = 0U;
+	};
+
+	// Makes chunk current, enlarging it if it's smaller than size
+	void UseChunk(const std::size_t chunkIdx, const std::size_t size);
+	// Writes chunks filled so far, including the current one
+	bool WriteChunks();
+
+private:
+	int m_fileDescriptor;
+	std::vector<Chunk> m_chunks;
+	std::size_t m_currentChunkIdx = 0U;
+};
+
+/*
+* @brief Sink writing into memory provided by user, for example pre-registered network buffer
+*
+* Sink never allocates, data not fitting the buffer is dropped, and sink reports failure.
+*/
+class FixedBufferOutputSink
+	: public OutputSink
+{
+public:
+	RAVEN_SERIALIZE_API FixedBufferOutputSink(char* buffer, const std::size_t size);
+
+	const char* GetData() const
+	{
+		return m_begin;
+	}
+
+	std::size_t GetSize() const
+	{
+		return static_cast<std::size_t>(m_cursor - m_begin);
+	}
+
+protected:
+	bool RAVEN_SERIALIZE_API Grow(const std::size_t size) final;
+};
+
+} // namespace rs
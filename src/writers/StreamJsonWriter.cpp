@@ -1,233 +1,324 @@
 #include "writers/StreamJsonWriter.hpp"
+#include "rttr/Manager.hpp"
+#include "rttr/Property.hpp"
+#include "rs/SerializationKeywords.hpp"
+#include "rs/log/Log.hpp"
 
 namespace rs
 {
 
 StreamJsonWriter::StreamJsonWriter(std::ostream& stream, const bool prettyPrint)
-	: m_stream(stream)
-	, m_prettyPrint(prettyPrint)
+	: m_streamSink(std::make_unique<StreamOutputSink>(stream))
+	, m_sink(*m_streamSink)
+	, m_emitter(m_sink, prettyPrint)
+{}
+
+StreamJsonWriter::StreamJsonWriter(OutputSink& sink, const bool prettyPrint)
+	: m_sink(sink)
+	, m_emitter(m_sink, prettyPrint)
 {}
 
 bool StreamJsonWriter::Write(const rttr::Type& type, const void* value)
 {
-	if (m_stream.good())
-	{
-		// Find in predefined types list
-		//auto predefinedTypeIt = g_predefinedJsonTypeResolvers.find(type.GetTypeIndex());
-		//if (predefinedTypeIt != g_predefinedJsonTypeResolvers.end())
-		//{
-		//	predefinedTypeIt->second->Read(type, value, jsonVal);
-		//	result = ReadResult::OKResult(); // Check errors from predefined types
-		//}
-		//else
-		//{
-			rs::SerializationMethod serializationMethod = type.GetSerializationMethod();
-
-			switch (serializationMethod)
-			{
-			case rs::SerializationMethod::Proxy:
-			{
-				//rttr::TypeProxyData* proxyTypeData = rttr::Manager::GetRTTRManager().GetProxyType(type);
-				//if (nullptr != proxyTypeData)
-				//{
-				//	result = ReadProxy(proxyTypeData, value, jsonVal);
-				//}
-			}
-			break;
-			case rs::SerializationMethod::Adapter:
+	if (!type.IsValid() || !value || !m_sink.IsOk())
+		return false;
+
+	m_emitter.Reset();
+	m_context = std::make_unique<rs::detail::SerializationContext>();
+
+	WriteValue(type, value, ObjectExtras());
+
+	m_context.reset();
+
+	return m_sink.Flush();
+}
+
+void StreamJsonWriter::WriteValue(const rttr::Type& type, const void* value, const ObjectExtras& extras)
+{
+	switch (type.GetPredefinedType())
+	{
+	case rs::PredefinedType::StdString:
+	{
+		const std::string& str = *static_cast<const std::string*>(value);
+		m_emitter.WriteString(str.data(), str.size());
+	}
+	return;
+	case rs::PredefinedType::CString:
+	{
+		const char* str = static_cast<const char*>(*reinterpret_cast<const void* const*>(value));
+		if (nullptr == str)
+		{
+			m_emitter.WriteNull();
+		}
+		else
+		{
+			m_emitter.WriteString(str);
+		}
+	}
+	return;
+	default:
+		break;
+	}
+
+	switch (type.GetSerializationMethod())
+	{
+	case rs::SerializationMethod::Proxy:
+	{
+		rttr::TypeProxyData* proxyTypeData = type.GetProxyType();
+		if (nullptr != proxyTypeData && proxyTypeData->writeConverter)
+		{
+			void* targetObject = m_context->CreateTempVariable(proxyTypeData->proxyType);
+			proxyTypeData->writeConverter->Convert(targetObject, value);
+
+			WriteValue(proxyTypeData->proxyType, targetObject, extras);
+
+			m_context->DestroyTempVariable(targetObject);
+		}
+		else
+		{
+			m_emitter.WriteNull();
+		}
+	}
+	break;
+	case rs::SerializationMethod::Adapter:
+	{
+		SerializationAdapter* adapter = type.GetSerializationAdapter();
+		if (nullptr != adapter)
+		{
+			WriteAdapter(adapter, value);
+		}
+		else
+		{
+			m_emitter.WriteNull();
+		}
+	}
+	break;
+	default:
+	{
+		switch (type.GetTypeClass())
+		{
+		case rttr::TypeClass::Object:
+		{
+			WriteObject(type, value, extras);
+		}
+		break;
+		case rttr::TypeClass::Enum:
+		{
+			WriteValue(type.GetEnumUnderlyingType(), value, extras);
+		}
+		break;
+		case rttr::TypeClass::Real:
+		{
+			if (type.GetTypeIndex() == typeid(float))
 			{
-				//SerializationAdapter* adapter = rttr::Manager::GetRTTRManager().GetSerializationAdapter(type);
-				//if (nullptr != adapter)
-				//{
-				//	// Parse payload
-				//	SerializationAdapter::DataChunk payload;
-				//	payload.type = adapter->GetPayloadType();
-
-				//	if (payload.type.IsValid() && jsonVal.isObject() && jsonVal.isMember(K_ADAPTER))
-				//	{
-				//		// If it's a json object with adapter member, treat it as payload
-				//		payload.value = m_context->CreateTempVariable(payload.type);
-				//		ReadResult payloadReadResult = ReadImpl(payload.type, payload.value, jsonVal[K_ADAPTER]);
-				//	}
-
-				//	// Perform adapter logic (payload can be empty)
-				//	SerializationAdapter::AdapterReadOutput adapterOutput = adapter->ReadConvert(payload);
-
-				//	// Read json value as converted type
-				//	if (adapterOutput.convertedType.IsValid())
-				//	{
-				//		void* adapterValue = m_context->CreateTempVariable(adapterOutput.convertedType);
-				//		result = ReadImpl(adapterOutput.convertedType, adapterValue, jsonVal);
-
-				//		adapter->ReadFinalize(adapterValue, value, adapterOutput, payload);
-				//	}
-				//}
+				m_emitter.WriteFloat(*static_cast<const float*>(value));
 			}
-			break;
-			default:
+			else
 			{
-				switch (type.GetTypeClass())
-				{
-				case rttr::TypeClass::Object:
-				{
-					//result = ReadResult::OKResult();
-
-					//ReadResult basesReadResult = ReadObjectBases(type, value, jsonVal);
-					//result.Merge(basesReadResult);
-					m_stream << '{';
-
-					// Read object properties if any
-					const std::size_t propertiesCount = type.GetPropertiesCount();
-					if (propertiesCount > 0U)
-					{
-						//ReadResult propertiesReadResult = ReadObjectProperties(type, value, jsonVal, propertiesCount);
-						//result.Merge(propertiesReadResult);
-					}
-
-					// Read collection items if this type is a collection
-					if (type.IsCollection())
-					{
-						//ReadResult collectionReadResult = ReadCollection(type, value, jsonVal, propertiesCount);
-						//result.Merge(collectionReadResult);
-					}
-
-					m_stream << '}';
-				}
-				break;
-				case rttr::TypeClass::Pointer:
-				{
-					//result = ReadPointer(type, value, jsonVal);
-				}
-				break;
-				case rttr::TypeClass::Enum:
-				{
-					//rttr::Type enumUnderlyingType = type.GetEnumUnderlyingType();
-					//result = ReadImpl(enumUnderlyingType, value, jsonVal);
-				}
-				break;
-				case rttr::TypeClass::Real:
-				{
-					//double valueToAssign = 0.0;
-
-					//if (jsonVal.isNumeric())
-					//{
-					//	valueToAssign = jsonVal.asDouble();
-					//	result = ReadResult::OKResult();
-					//}
-					//else
-					//{
-					//	result = ReadResult::GenericFailResult();
-					//}
-
-					//if (type.GetTypeIndex() == typeid(float))
-					//{
-					//	*static_cast<float*>(value) = static_cast<float>(valueToAssign);
-					//}
-					//else
-					//{
-					//	*static_cast<double*>(value) = valueToAssign;
-					//}
-				}
-				break;
-				case rttr::TypeClass::Integral:
-				{
-					//if (type.GetTypeIndex() == typeid(bool))
-					//{
-					//	switch (jsonVal.type())
-					//	{
-					//	case Json::booleanValue:
-					//	{
-					//		*static_cast<bool*>(value) = jsonVal.asBool();
-					//		result = ReadResult::OKResult();
-					//	}
-					//	break;
-					//	case Json::intValue:
-					//	case Json::uintValue:
-					//	case Json::nullValue:
-					//	{
-					//		*static_cast<bool*>(value) = !!jsonVal.asUInt64();
-					//		result = ReadResult::OKResult();
-					//	}
-					//	break;
-					//	default:
-					//		break;
-					//	}
-					//}
-					//else
-					//{
-					//	if (type.IsSignedIntegral())
-					//	{
-					//		int64_t intValue = jsonVal.asInt64();
-
-					//		switch (type.GetSize())
-					//		{
-					//		case 1:
-					//			*static_cast<int8_t*>(value) = static_cast<int8_t>(intValue);
-					//			break;
-					//		case 2:
-					//			*static_cast<int16_t*>(value) = static_cast<int16_t>(intValue);
-					//			break;
-					//		case 4:
-					//			*static_cast<int32_t*>(value) = static_cast<int32_t>(intValue);
-					//			break;
-					//		case 8:
-					//		default:
-					//			*static_cast<int64_t*>(value) = intValue;
-					//			break;
-					//		}
-
-					//		result = ReadResult::OKResult();
-					//	}
-					//	else
-					//	{
-					//		uint64_t intValue = jsonVal.asUInt64();
-
-					//		switch (type.GetSize())
-					//		{
-					//		case 1:
-					//			*static_cast<uint8_t*>(value) = static_cast<uint8_t>(intValue);
-					//			break;
-					//		case 2:
-					//			*static_cast<uint16_t*>(value) = static_cast<uint16_t>(intValue);
-					//			break;
-					//		case 4:
-					//			*static_cast<uint32_t*>(value) = static_cast<uint32_t>(intValue);
-					//			break;
-					//		case 8:
-					//		default:
-					//			*static_cast<uint64_t*>(value) = intValue;
-					//			break;
-					//		}
-
-					//		result = ReadResult::OKResult();
-					//	}
-					//}
-				}
-				break;
-				case rttr::TypeClass::Array:
-				{
-					//result = ReadArray(type, value, jsonVal);
-				}
-				break;
-				}
-			}
-			break;
+				m_emitter.WriteDouble(*static_cast<const double*>(value));
 			}
+		}
+		break;
+		case rttr::TypeClass::Integral:
+		{
+			WriteIntegral(type, value);
+		}
+		break;
+		case rttr::TypeClass::Array:
+		{
+			WriteArray(type, value);
+		}
+		break;
+		case rttr::TypeClass::Pointer:
+		default:
+		{
+			m_emitter.WriteNull();
+		}
+		break;
+		}
+	}
+	break;
+	}
+}
 
-		//}
+void StreamJsonWriter::WriteObject(const rttr::Type& type, const void* value, const ObjectExtras& extras)
+{
+	const std::size_t propertiesCount = type.GetPropertiesCount();
+	const auto& baseClassesInfo = type.GetBaseClasses();
+	const bool isCollection = type.IsCollection();
+	const bool hasPayload = extras.payload.type.IsValid() && extras.payload.value;
 
-		return true;
+	// Collection without any other members is written as plain array
+	if (isCollection && propertiesCount == 0U && !extras.baseId && !hasPayload && baseClassesInfo.second == 0U)
+	{
+		WriteCollectionItems(type, value);
+		return;
+	}
+
+	m_emitter.BeginScope('{');
+
+	if (extras.baseId)
+	{
+		m_emitter.WriteKey(K_BASE_ID);
+		m_emitter.WriteString(extras.baseId);
 	}
 
-	return false;
+	if (hasPayload)
+	{
+		m_emitter.WriteKey(K_ADAPTER);
+		WriteValue(extras.payload.type, extras.payload.value, ObjectExtras());
+	}
+
+	if (baseClassesInfo.second > 0U)
+	{
+		m_emitter.WriteKey(K_BASES);
+		m_emitter.BeginScope('[');
+
+		for (uint8_t i = 0U; i < baseClassesInfo.second; ++i)
+		{
+			const rttr::Type& baseClass = baseClassesInfo.first[i];
+
+			ObjectExtras baseExtras;
+			baseExtras.baseId = baseClass.GetName();
+
+			m_emitter.BeginItem();
+			WriteObject(baseClass, value, baseExtras);
+		}
+
+		m_emitter.EndScope(']');
+	}
+
+	for (std::size_t i = 0U; i < propertiesCount; ++i)
+	{
+		rttr::Property* const prop = type.GetProperty(i);
+
+		void* propValue = nullptr;
+		bool needRelease = false;
+		prop->GetValue(value, propValue, needRelease);
+
+		m_emitter.WriteKey(prop->GetName());
+		WriteValue(prop->GetType(), propValue, ObjectExtras());
+
+		// Release temp object if required
+		if (needRelease)
+		{
+			prop->GetType().Destroy(propValue);
+		}
+	}
+
+	if (isCollection)
+	{
+		m_emitter.WriteKey(K_COLLECTION_ITEMS);
+		WriteCollectionItems(type, value);
+	}
+
+	m_emitter.EndScope('}');
 }
 
-void StreamJsonWriter::WritePadding()
+void StreamJsonWriter::WriteCollectionItems(const rttr::Type& type, const void* value)
 {
-	for (int i = 0; i < m_padding; i++)
+	const rttr::Type itemType = type.GetCollectionItemType();
+
+	if (itemType.IsPlainNumeric() && type.IsContiguousCollection())
 	{
-		m_stream << '\t';
+		std::size_t itemsCount = 0U;
+		const void* items = type.GetCollectionItemsData(value, itemsCount);
+
+		m_emitter.WriteNumericItems(itemType.GetNumericKind(), items, itemsCount);
+		return;
+	}
+
+	m_emitter.BeginScope('[');
+
+	std::unique_ptr<rttr::CollectionIteratorBase> it = type.CreateCollectionIterator(const_cast<void*>(value));
+	if (it)
+	{
+		for (; *it; ++(*it))
+		{
+			m_emitter.BeginItem();
+			WriteValue(itemType, *(*it), ObjectExtras());
+		}
 	}
+	else
+	{
+		RS_LOG_ERROR("Collection '%s' can't be iterated, items are not written!", type.GetName());
+	}
+
+	m_emitter.EndScope(']');
 }
 
+void StreamJsonWriter::WriteAdapter(SerializationAdapter* adapter, const void* value)
+{
+	SerializationAdapter::AdapterWriteOutput adapterOutput = adapter->Write(value);
+
+	// Payload is attached to value object, as json writer does
+	ObjectExtras extras;
+	extras.payload = adapterOutput.payload;
+
+	if (adapterOutput.value.type.IsValid() && adapterOutput.value.value)
+	{
+		WriteValue(adapterOutput.value.type, adapterOutput.value.value, extras);
+	}
+	else
+	{
+		m_emitter.BeginScope('{');
+
+		if (extras.payload.type.IsValid() && extras.payload.value)
+		{
+			m_emitter.WriteKey(K_ADAPTER);
+			WriteValue(extras.payload.type, extras.payload.value, ObjectExtras());
+		}
+
+		m_emitter.EndScope('}');
+	}
+
+	adapter->WriteFinalize(value);
 }
+
+void StreamJsonWriter::WriteArray(const rttr::Type& type, const void* value)
+{
+	const rttr::Type arrayType = type.GetArrayType();
+	const uint8_t* arrayBytePtr = static_cast<const uint8_t*>(value);
+	const std::size_t itemSize = arrayType.GetSize();
+
+	std::size_t totalSize = type.GetArrayExtent(0U);
+	for (std::size_t i = 1U; i < type.GetArrayRank(); ++i)
+	{
+		totalSize *= type.GetArrayExtent(i);
+	}
+
+	// Arrays of numbers are written at once, skipping per item dispatch
+	if (arrayType.IsPlainNumeric())
+	{
+		m_emitter.WriteNumericItems(arrayType.GetNumericKind(), value, totalSize);
+		return;
+	}
+
+	m_emitter.BeginScope('[');
+
+	for (std::size_t i = 0U; i < totalSize; i++)
+	{
+		m_emitter.BeginItem();
+		WriteValue(arrayType, arrayBytePtr + itemSize * i, ObjectExtras());
+	}
+
+	m_emitter.EndScope(']');
+}
+
+void StreamJsonWriter::WriteIntegral(const rttr::Type& type, const void* value)
+{
+	if (type.GetTypeIndex() == typeid(bool))
+	{
+		m_emitter.WriteBool(*static_cast<const bool*>(value));
+	}
+	else if (type.IsSignedIntegral())
+	{
+		m_emitter.WriteSigned(type.CastToSignedInteger(value));
+	}
+	else
+	{
+		m_emitter.WriteUnsigned(type.CastToUnsignedInteger(value));
+	}
+}
+
+} // namespace rs
@@ -1,25 +1,56 @@
 #pragma once
-#include "writers/JsonWriter.hpp"
+#include "writers/IWriter.hpp"
+#include "writers/OutputSink.hpp"
+#include "writers/JsonEmitter.hpp"
+#include "rs/SerializationAdapter.hpp"
+#include "SerializationContext.hpp"
+
+#include <ostream>
+#include <memory>
 
 namespace rs
 {
 
-class StreamJsonWriter : public JsonWriter
+/*
+* @brief Json writer emitting tokens straight to the output sink, without building Json::Value tree
+*
+* Documents have the same structure as JsonWriter ones and are read by JsonReader. Tokens are appended to the sink buffer,
+* which passes them on when full, so memory used depends on nesting depth only, not on the size of written data.
+* Unlike JsonWriter, it doesn't write object graphs: pointers are written as null, and no objects section is written.
+*/
+class StreamJsonWriter
+	: public IWriter
 {
 public:
 	StreamJsonWriter() = delete;
 	explicit RAVEN_SERIALIZE_API StreamJsonWriter(std::ostream& stream, const bool prettyPrint = true);
+	// Sink is not owned and must outlive the writer
+	explicit RAVEN_SERIALIZE_API StreamJsonWriter(OutputSink& sink, const bool prettyPrint = true);
 	~StreamJsonWriter() = default;
 
 	bool RAVEN_SERIALIZE_API Write(const rttr::Type& type, const void* value) override;
 
 private:
-	void WritePadding();
+	// Reserved members written in front of object properties
+	struct ObjectExtras
+	{
+		const char* baseId = nullptr;
+		SerializationAdapter::DataChunk payload;
+	};
+
+	void WriteValue(const rttr::Type& type, const void* value, const ObjectExtras& extras);
+	void WriteObject(const rttr::Type& type, const void* value, const ObjectExtras& extras);
+	void WriteCollectionItems(const rttr::Type& type, const void* value);
+	void WriteAdapter(SerializationAdapter* adapter, const void* value);
+	void WriteArray(const rttr::Type& type, const void* value);
+	void WriteIntegral(const rttr::Type& type, const void* value);
 
 private:
-	std::ostream& m_stream;
-	const bool m_prettyPrint;
-	int m_padding = 0;
+	// Sink created for the stream
+	std::unique_ptr<OutputSink> m_streamSink;
+	OutputSink& m_sink;
+	detail::JsonEmitter m_emitter;
+	std::unique_ptr<rs::detail::SerializationContext> m_context;
 };
 
-}
+} // namespace rs